@@ -27,7 +27,11 @@ namespace Gts {
 		std::string flushLevel = toml::find_or<std::string>(data, "flushLevel", "trace");
 		this->_logLevel = spdlog::level::from_str(logLevel);
 		this->_flushLevel = spdlog::level::from_str(flushLevel);
+		this->_asyncLog = toml::find_or<bool>(data, "asyncLog", true);
+		this->_logRateLimit = static_cast<std::uint32_t>(std::max(toml::find_or<int>(data, "logRateLimit", static_cast<int>(AsyncLogSink::RATE_LIMIT)), 0));
 		this->_shouldProfile = toml::find_or<bool>(data, "profile", false);
+		this->_exportProfileCsv = toml::find_or<bool>(data, "profileCsv", false);
+		this->_exportProfileTrace = toml::find_or<bool>(data, "profileTrace", false);
 	}
 
 	Frame::Frame(const toml::value& data) {
@@ -54,11 +58,17 @@ namespace Gts {
 		this->_minScale = toml::find_or<float>(data, "minScale", 0.0f);
 	}
 
+	RoomScale::RoomScale(const toml::value& data) {
+		this->_raycastBudget = toml::find_or<int>(data, "raycastBudget", 2);
+		this->_refreshInterval = toml::find_or<float>(data, "refreshInterval", 0.5f);
+	}
+
 	Config::Config(const toml::value& data) {
 		this->_debug =  toml::find<Debug>(data, "debug");
 		this->_frame =  toml::find<Frame>(data, "frame");
 		this->_tremor =  toml::find<Tremor>(data, "tremor");
 		this->_voice =  toml::find<Voice>(data, "voice");
 		this->_utilBools = toml::find<UtilBools>(data, "UtilBools");
+		this->_roomScale = toml::find_or<RoomScale>(data, "roomScale", RoomScale()); // Optional, older configs don't have it
 	}
 }
@@ -15,15 +15,35 @@ namespace Gts {
 				return _flushLevel;
 			}
 
+			[[nodiscard]] inline bool ShouldLogAsync() const noexcept {
+				return _asyncLog;
+			}
+
+			[[nodiscard]] inline std::uint32_t GetLogRateLimit() const noexcept {
+				return _logRateLimit;
+			}
+
 			[[nodiscard]] inline bool ShouldProfile() const noexcept {
 				return _shouldProfile;
 			}
 
+			[[nodiscard]] inline bool ShouldExportProfileCsv() const noexcept {
+				return _exportProfileCsv;
+			}
+
+			[[nodiscard]] inline bool ShouldExportProfileTrace() const noexcept {
+				return _exportProfileTrace;
+			}
+
 			Debug(const toml::value& data);
 
 			spdlog::level::level_enum _logLevel{spdlog::level::level_enum::info};
 			spdlog::level::level_enum _flushLevel{spdlog::level::level_enum::trace};
+			bool _asyncLog = true;
+			std::uint32_t _logRateLimit = AsyncLogSink::RATE_LIMIT;
 			bool _shouldProfile = false;
+			bool _exportProfileCsv = false;
+			bool _exportProfileTrace = false;
 	};
 
 	class Frame {
@@ -105,6 +125,23 @@ namespace Gts {
 			float _minScale;
 	};
 
+	class RoomScale {
+		public:
+			RoomScale() = default;
+
+			[[nodiscard]] inline int GetRaycastBudget() const noexcept {
+				return _raycastBudget;
+			}
+			[[nodiscard]] inline float GetRefreshInterval() const noexcept {
+				return _refreshInterval;
+			}
+			RoomScale(const toml::value& data);
+
+		private:
+			int _raycastBudget = 2;
+			float _refreshInterval = 0.5f;
+	};
+
 	class Config {
 		public:
 			Config() = default;
@@ -129,6 +166,10 @@ namespace Gts {
 				return _utilBools;
 			}
 
+			[[nodiscard]] inline const RoomScale& GetRoomScale() const noexcept {
+				return _roomScale;
+			}
+
 			[[nodiscard]] static const Config& GetSingleton() noexcept;
 
 			Config(const toml::value& data);
@@ -139,5 +180,6 @@ namespace Gts {
 			Tremor _tremor;
 			Voice _voice;
 			UtilBools _utilBools;
+			RoomScale _roomScale;
 	};
 }
@@ -108,6 +108,7 @@
 
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/msvc_sink.h>
+#include "utils/AsyncLog.hpp"
 
 // Compatible declarations with other sample projects.
 #define DLLEXPORT __declspec(dllexport)
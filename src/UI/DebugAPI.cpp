@@ -6,7 +6,8 @@
 
 using namespace Gts;
 
-std::vector<DebugAPILine*> DebugAPI::LinesToDraw;
+std::vector<DebugAPILine> DebugAPI::LinesToDraw;
+std::unordered_map<std::uint64_t, std::uint32_t> DebugAPI::LineIndex;
 
 bool DebugAPI::CachedMenuData;
 
@@ -24,11 +25,13 @@ DebugAPILine::DebugAPILine(glm::vec3 from, glm::vec3 to, glm::vec4 color, float
 	Alpha = color.a * 100.0f;
 	LineThickness = lineThickness;
 	DestroyTickCount = destroyTickCount;
+	Key = 0;
 }
 
 void DebugAPI::DrawLineForMS(const glm::vec3& from, const glm::vec3& to, int liftetimeMS, const glm::vec4& color, float lineThickness)
 {
-	DebugAPILine* oldLine = GetExistingLine(from, to, color, lineThickness);
+	std::uint64_t key = LineKey(from, to, color, lineThickness);
+	DebugAPILine* oldLine = GetExistingLine(key, from, to, color, lineThickness);
 	if (oldLine) {
 		oldLine->From = from;
 		oldLine->To = to;
@@ -37,8 +40,11 @@ void DebugAPI::DrawLineForMS(const glm::vec3& from, const glm::vec3& to, int lif
 		return;
 	}
 
-	DebugAPILine* newLine = new DebugAPILine(from, to, color, lineThickness, GetTickCount64() + liftetimeMS);
-	LinesToDraw.push_back(newLine);
+	DebugAPILine& newLine = LinesToDraw.emplace_back(from, to, color, lineThickness, GetTickCount64() + liftetimeMS);
+	// On a collision with a different line this one is drawn but can't be deduped
+	if (LineIndex.try_emplace(key, static_cast<std::uint32_t>(LinesToDraw.size() - 1)).second) {
+		newLine.Key = key;
+	}
 }
 
 void DebugAPI::Update()
@@ -50,20 +56,89 @@ void DebugAPI::Update()
 
 	CacheMenuData();
 	ClearLines2D(hud->uiMovie);
+	DrawLines(hud->uiMovie);
 
-	for (int i = 0; i < LinesToDraw.size(); i++)
+	// Expired lines are compacted out in one pass. The order is kept so that
+	// segments of the same circle/capsule stay next to each other for DrawLines
+	unsigned __int64 now = GetTickCount64();
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < LinesToDraw.size(); i++)
 	{
-		DebugAPILine* line = LinesToDraw[i];
+		DebugAPILine& line = LinesToDraw[i];
+		if (now > line.DestroyTickCount) {
+			if (line.Key != 0) {
+				LineIndex.erase(line.Key);
+			}
+			continue;
+		}
+		if (kept != i) {
+			LinesToDraw[kept] = line;
+			if (line.Key != 0) {
+				LineIndex[line.Key] = static_cast<std::uint32_t>(kept);
+			}
+		}
+		kept++;
+	}
+	LinesToDraw.erase(LinesToDraw.begin() + kept, LinesToDraw.end());
+}
+
+void DebugAPI::DrawLines(RE::GPtr<RE::GFxMovieView> movie)
+{
+	// Same for every line this frame
+	auto cameraPos = GetCameraPos();
+	auto cameraForward = NormalizeVector(GetForwardVector(GetCameraRot()));
+	RE::GRectF rect = movie->GetVisibleFrameRect();
+
+	bool hasStyle = false;
+	float styleColor = 0.0f;
+	float styleThickness = 0.0f;
+	float styleAlpha = 0.0f;
 
-		DrawLine3D(hud->uiMovie, line->From, line->To, line->fColor, line->LineThickness, line->Alpha);
+	// Where the last lineTo ended, a connected segment doesn't need a moveTo
+	bool hasPen = false;
+	glm::vec2 pen;
+
+	for (const auto& line: LinesToDraw)
+	{
+		if (IsPosBehindCamera(line.From, cameraPos, cameraForward) && IsPosBehindCamera(line.To, cameraPos, cameraForward)) {
+			hasPen = false;
+			continue;
+		}
 
-		if (GetTickCount64() > line->DestroyTickCount) {
-			LinesToDraw.erase(LinesToDraw.begin() + i);
-			delete line;
+		glm::vec2 from = WorldToScreenLoc(rect, line.From);
+		glm::vec2 to = WorldToScreenLoc(rect, line.To);
 
-			i--;
+		// all parts of the line are off screen - don't need to draw them
+		if (!IsOnScreen(from, to)) {
+			hasPen = false;
 			continue;
 		}
+
+		FastClampToScreen(from);
+		FastClampToScreen(to);
+
+		if (!hasStyle || styleColor != line.fColor || styleThickness != line.LineThickness || styleAlpha != line.Alpha) {
+			RE::GFxValue argsLineStyle[3]{ line.LineThickness, line.fColor, line.Alpha };
+			movie->Invoke("lineStyle", nullptr, argsLineStyle, 3);
+			hasStyle = true;
+			styleColor = line.fColor;
+			styleThickness = line.LineThickness;
+			styleAlpha = line.Alpha;
+		}
+
+		if (!hasPen || pen != from) {
+			RE::GFxValue argsStartPos[2]{ from.x, from.y };
+			movie->Invoke("moveTo", nullptr, argsStartPos, 2);
+		}
+
+		RE::GFxValue argsEndPos[2]{ to.x, to.y };
+		movie->Invoke("lineTo", nullptr, argsEndPos, 2);
+		hasPen = true;
+		pen = to;
+	}
+
+	if (hasStyle) {
+		movie->Invoke("endFill", nullptr, nullptr, 0);
 	}
 }
 
@@ -409,11 +484,36 @@ void DebugAPI::DrawTriangle(glm::vec3 pointA, glm::vec3 pointB, glm::vec3 pointC
 }
 
 
-DebugAPILine* DebugAPI::GetExistingLine(const glm::vec3& from, const glm::vec3& to, const glm::vec4& color, float lineThickness)
+std::uint64_t DebugAPI::LineKey(const glm::vec3& from, const glm::vec3& to, const glm::vec4& color, float lineThickness)
 {
-	for (int i = 0; i < LinesToDraw.size(); i++)
+	std::uint64_t hash = 14695981039346656037ull;
+	auto mix = [&hash](std::uint32_t value) {
+		hash ^= value;
+		hash *= 1099511628211ull;
+	};
+	auto snap = [](float value) {
+		return static_cast<std::uint32_t>(static_cast<std::int32_t>(floor(value / DRAW_LOC_MAX_DIF)));
+	};
+
+	mix(snap(from.x));
+	mix(snap(from.y));
+	mix(snap(from.z));
+	mix(snap(to.x));
+	mix(snap(to.y));
+	mix(snap(to.z));
+	mix(snap(lineThickness));
+	for (int i = 0; i < 4; i++) {
+		mix(std::bit_cast<std::uint32_t>(color[i]));
+	}
+	return hash != 0 ? hash : 1;
+}
+
+DebugAPILine* DebugAPI::GetExistingLine(std::uint64_t key, const glm::vec3& from, const glm::vec3& to, const glm::vec4& color, float lineThickness)
+{
+	auto found = LineIndex.find(key);
+	if (found != LineIndex.end())
 	{
-		DebugAPILine* line = LinesToDraw[i];
+		DebugAPILine* line = &LinesToDraw[found->second];
 
 		if (
 			IsRoughlyEqual(from.x, line->From.x, DRAW_LOC_MAX_DIF) &&
@@ -548,6 +648,11 @@ float DebugAPI::ConvertComponentB(float value)
 }
 
 glm::vec2 DebugAPI::WorldToScreenLoc(RE::GPtr<RE::GFxMovieView> movie, glm::vec3 worldLoc)
+{
+	return WorldToScreenLoc(movie->GetVisibleFrameRect(), worldLoc);
+}
+
+glm::vec2 DebugAPI::WorldToScreenLoc(const RE::GRectF& rect, glm::vec3 worldLoc)
 {
 	glm::vec2 screenLocOut;
 	RE::NiPoint3 niWorldLoc(worldLoc.x, worldLoc.y, worldLoc.z);
@@ -555,7 +660,6 @@ glm::vec2 DebugAPI::WorldToScreenLoc(RE::GPtr<RE::GFxMovieView> movie, glm::vec3
 	float zVal;
 
 	RE::NiCamera::WorldPtToScreenPt3(World::WorldToCamera().data, World::ViewPort(), niWorldLoc, screenLocOut.x, screenLocOut.y, zVal, 1e-5f);
-	RE::GRectF rect = movie->GetVisibleFrameRect();
 
 	screenLocOut.x = rect.left + (rect.right - rect.left) * screenLocOut.x;
 	screenLocOut.y = 1.0f - screenLocOut.y;  // Flip y for Flash coordinate system
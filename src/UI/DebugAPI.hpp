@@ -116,13 +116,10 @@ namespace Util {
 		return RotateVector(quatIn, glm::vec3(0.0f, 1.0f, 0.0f));
 	}
 
-	inline bool IsPosBehindPlayerCamera(glm::vec3 pos)
+	// cameraForward must be normalized
+	inline bool IsPosBehindCamera(glm::vec3 pos, glm::vec3 cameraPos, glm::vec3 cameraForward)
 	{
-		auto cameraPos = GetCameraPos();
-		auto cameraRot = GetCameraRot();
-
 		auto toTarget = NormalizeVector(pos - cameraPos);
-		auto cameraForward = NormalizeVector(GetForwardVector(cameraRot));
 
 		auto angleDif = abs( glm::length(toTarget - cameraForward) );
 
@@ -131,6 +128,14 @@ namespace Util {
 		return angleDif > glm::root_two<float>();
 	}
 
+	inline bool IsPosBehindPlayerCamera(glm::vec3 pos)
+	{
+		auto cameraPos = GetCameraPos();
+		auto cameraRot = GetCameraRot();
+
+		return IsPosBehindCamera(pos, cameraPos, NormalizeVector(GetForwardVector(cameraRot)));
+	}
+
 	inline glm::vec3 GetPointOnRotatedCircle(glm::vec3 origin, float radius, float i, float maxI, glm::vec3 eulerAngles) {
 		float currAngle = (i / maxI) * glm::two_pi<float>();
 
@@ -240,6 +245,8 @@ class DebugAPILine
 		float LineThickness;
 
 		unsigned __int64 DestroyTickCount;
+		// Key in DebugAPI::LineIndex, 0 if the line is not indexed (hash collision)
+		std::uint64_t Key;
 };
 
 class DebugAPI
@@ -264,7 +271,10 @@ class DebugAPI
 		static void DrawTriangle(glm::vec3 pointA, glm::vec3 pointB, glm::vec3 pointC, glm::mat4 transform, int liftetimeMS = 10, const glm::vec4& color = { 1.0f, 0.0f, 0.0f, 1.0f }, float lineThickness = 1);
 		static void DrawBox(glm::vec3 origin, glm::vec3 halfExtents, glm::mat4 transform, int liftetimeMS = 10, const glm::vec4& color = { 1.0f, 0.0f, 0.0f, 1.0f }, float lineThickness = 1);
 
-		static std::vector<DebugAPILine*> LinesToDraw;
+		// Stored by value in draw order, expired lines are compacted out once per Update
+		static std::vector<DebugAPILine> LinesToDraw;
+		// Quantized from/to/color/thickness -> index in LinesToDraw
+		static std::unordered_map<std::uint64_t, std::uint32_t> LineIndex;
 
 		static bool DEBUG_API_REGISTERED;
 
@@ -273,6 +283,7 @@ class DebugAPI
 		static constexpr float DRAW_LOC_MAX_DIF = 1.0f;
 
 		static glm::vec2 WorldToScreenLoc(RE::GPtr<RE::GFxMovieView> movie, glm::vec3 worldLoc);
+		static glm::vec2 WorldToScreenLoc(const RE::GRectF& rect, glm::vec3 worldLoc);
 		static float RGBToHex(glm::vec3 rgb);
 
 		static void FastClampToScreen(glm::vec2& point);
@@ -294,9 +305,13 @@ class DebugAPI
 		static float ConvertComponentR(float value);
 		static float ConvertComponentG(float value);
 		static float ConvertComponentB(float value);
-		// returns true if there is already a line with the same color at around the same from and to position
+		// Draws every line in LinesToDraw, only sending lineStyle/moveTo to the movie when they change
+		static void DrawLines(RE::GPtr<RE::GFxMovieView> movie);
+		// from/to are snapped to a DRAW_LOC_MAX_DIF grid, never returns 0
+		static std::uint64_t LineKey(const glm::vec3& from, const glm::vec3& to, const glm::vec4& color, float lineThickness);
+		// returns the line with the same key if it has the same color at around the same from and to position
 		// with some leniency to bundle together lines in roughly the same spot (see DRAW_LOC_MAX_DIF)
-		static DebugAPILine* GetExistingLine(const glm::vec3& from, const glm::vec3& to, const glm::vec4& color, float lineThickness);
+		static DebugAPILine* GetExistingLine(std::uint64_t key, const glm::vec3& from, const glm::vec3& to, const glm::vec4& color, float lineThickness);
 };
 
 class DebugOverlayMenu : RE::IMenu, public Gts::EventListener
@@ -49,20 +49,22 @@ namespace {
 		*path /= PluginDeclaration::GetSingleton()->GetName();
 		*path += L".log";
 
-		std::shared_ptr <spdlog::logger> log;
+		std::shared_ptr <spdlog::sinks::sink> sink;
 
 		if (IsDebuggerPresent()) {
-			log = std::make_shared <spdlog::logger>(
-				"Global", std::make_shared <spdlog::sinks::msvc_sink_mt>());
+			sink = std::make_shared <spdlog::sinks::msvc_sink_mt>();
 		} else {
-			log = std::make_shared <spdlog::logger>(
-				"Global", std::make_shared <spdlog::sinks::basic_file_sink_mt>(path->string(), true));
+			sink = std::make_shared <spdlog::sinks::basic_file_sink_mt>(path->string(), true);
 		}
 
+		auto log = std::make_shared <spdlog::logger>(
+			"Global", std::make_shared <AsyncLogSink>(std::move(sink)));
+
 		spdlog::set_default_logger(std::move(log));
 		spdlog::set_pattern("[%Y-%m-%d %H:%M:%S.%e][%t][%l] [%s:%#] %v");
-		spdlog::set_level(spdlog::level::level_enum::trace);
-		spdlog::flush_on(spdlog::level::level_enum::trace);
+		spdlog::set_level(static_cast<spdlog::level::level_enum>(SPDLOG_ACTIVE_LEVEL));
+		// Only errors wait until they are written, the sink flushes everything else from its writer thread
+		spdlog::flush_on(spdlog::level::level_enum::err);
 
 	}
 
@@ -149,7 +151,7 @@ namespace {
 }
 
 static void InitializeSerialization() {
-	log::trace("Initializing cosave serialization...");
+	GTS_LOG_TRACE("Initializing cosave serialization...");
 	auto* serde = GetSerializationInterface();
 	serde->SetUniqueID(_byteswap_ulong('GTSP'));
 	serde->SetSaveCallback(Persistent::OnGameSaved);
@@ -159,7 +161,7 @@ static void InitializeSerialization() {
 }
 
 static void InitializePapyrus() {
-	log::trace("Initializing Papyrus binding...");
+	GTS_LOG_TRACE("Initializing Papyrus binding...");
 	if (GetPapyrusInterface()->Register(Gts::register_papyrus)) {
 		log::info("Papyrus functions bound.");
 	} else {
@@ -201,8 +203,15 @@ static void SetLogLevel() {
 		const auto& debugConfig = Gts::Config::GetSingleton().GetDebug();
 		log::info("Config Loaded");
 
-		spdlog::set_level(debugConfig.GetLogLevel());
-		spdlog::flush_on(debugConfig.GetFlushLevel());
+		spdlog::set_level(std::max(debugConfig.GetLogLevel(), static_cast<spdlog::level::level_enum>(SPDLOG_ACTIVE_LEVEL)));
+		for (auto& sink: spdlog::default_logger()->sinks()) {
+			auto asyncSink = std::dynamic_pointer_cast<AsyncLogSink>(sink);
+			if (asyncSink) {
+				asyncSink->SetFlushLevel(debugConfig.GetFlushLevel());
+				asyncSink->SetRateLimit(debugConfig.GetLogRateLimit());
+				asyncSink->SetAsync(debugConfig.ShouldLogAsync());
+			}
+		}
 	}
 	catch (exception e){
 		log::critical("Could not load config file", e.what());
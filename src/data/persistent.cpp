@@ -1,6 +1,7 @@
 #include "managers/animation/Utils/CooldownManager.hpp"
 #include "managers/GtsSizeManager.hpp"
 #include "utils/ItemDistributor.hpp"
+#include "utils/ActorRegistry.hpp"
 #include "utils/actorUtils.hpp"
 #include "data/persistent.hpp"
 #include "scale/modscale.hpp"
@@ -91,7 +92,7 @@ namespace Gts {
 	void Persistent::Reset() {
 		//Plugin::SetInGame(false);
 		std::unique_lock lock(this->_lock);
-		this->_actor_data.clear();
+		this->_actor_data.Clear();
 
     // Ensure we reset them back to inital scales
     // if they are loaded into game memory
@@ -397,7 +398,8 @@ namespace Gts {
 						if (actor_form) {
 							Actor* actor = skyrim_cast<Actor*>(actor_form);
 							if (actor) {
-								GetSingleton()._actor_data.insert_or_assign(newActorFormID, data);
+								std::unique_lock lock(GetSingleton()._lock);
+								GetSingleton()._actor_data.InsertOrAssign(newActorFormID, data);
 							} else {
 								log::warn("Actor ID {:X} could not be found after loading the save.", newActorFormID);
 							}
@@ -685,7 +687,7 @@ namespace Gts {
 			return;
 		}
 
-		auto count = GetSingleton()._actor_data.size();
+		auto count = GetSingleton()._actor_data.Size();
 		serde->WriteRecordData(&count, sizeof(count));
 		for (auto const& [form_id_t, data] : GetSingleton()._actor_data) {
 			FormID form_id = form_id_t;
@@ -1202,24 +1204,22 @@ namespace Gts {
 		return this->GetActorData(*actor);
 	}
 	ActorData* Persistent::GetActorData(Actor& actor) {
-		std::unique_lock lock(this->_lock);
 		auto key = actor.formID;
-		ActorData* result = nullptr;
-		try {
-			result = &this->_actor_data.at(key);
-		} catch (const std::out_of_range& oor) {
-			// Add new
-			if (!actor.Is3DLoaded()) {
-				return nullptr;
-			}
-			auto scale = get_scale(&actor);
-			if (scale < 0.0f) {
-				return nullptr;
-			}
-			this->_actor_data.try_emplace(key, &actor);
-			result = &this->_actor_data.at(key);
+		// Lock free on a hit, only adding a new actor is serialized
+		ActorData* result = this->_actor_data.Find(key);
+		if (result) {
+			return result;
+		}
+		// Add new
+		if (!actor.Is3DLoaded()) {
+			return nullptr;
+		}
+		auto scale = get_scale(&actor);
+		if (scale < 0.0f) {
+			return nullptr;
 		}
-		return result;
+		std::unique_lock lock(this->_lock);
+		return this->_actor_data.TryEmplace(key, &actor).first;
 	}
 
 	ActorData* Persistent::GetData(TESObjectREFR* refr) {
@@ -1229,14 +1229,22 @@ namespace Gts {
 		return this->GetData(*refr);
 	}
 	ActorData* Persistent::GetData(TESObjectREFR& refr) {
-		auto key = refr.formID;
-		ActorData* result = nullptr;
-		try {
-			result = &this->_actor_data.at(key);
-		} catch (const std::out_of_range& oor) {
-			return nullptr;
+		return this->_actor_data.Find(refr.formID);
+	}
+
+	ActorData* Persistent::GetData(const ActorRecord& record) {
+		ActorData* result = this->_actor_data.Get(record.persistent);
+		if (result) {
+			return result;
+		}
+		return this->GetData(record.actor);
+	}
+
+	SlotHandle Persistent::GetHandle(TESObjectREFR* refr) const {
+		if (!refr) {
+			return SlotHandle();
 		}
-		return result;
+		return this->_actor_data.FindHandle(refr->formID);
 	}
 
 	void Persistent::ResetActor(Actor* actor) {
@@ -3,6 +3,7 @@
 
 #include "events.hpp"
 #include "scale/modscale.hpp"
+#include "data/slotmap.hpp"
 
 using namespace std;
 using namespace SKSE;
@@ -10,16 +11,22 @@ using namespace RE;
 using namespace Gts;
 
 namespace Gts {
+	struct ActorRecord;
+
 	struct ActorData {
-		float native_scale;
+		// Read for every actor every frame by the scale getters and the spring update
 		float visual_scale;
-		float visual_scale_v;
 		float target_scale;
+		float native_scale;
+		float visual_scale_v;
 		float target_scale_v;
 		float max_scale;
 		float half_life;
 		float anim_speed;
 		float effective_multi;
+		float scaleOverride;
+		float SizeVulnerability;
+
 		float bonus_hp;
 		float bonus_carry;
 		float bonus_max_size;
@@ -29,14 +36,11 @@ namespace Gts {
 		float SprintDamage; // 1
 		float FallDamage; // 2
 		float HHDamage; // 3
-		float SizeVulnerability;
 
 		float SizeReserve;
 
 		float AllowHitGrowth;
 
-		float scaleOverride;
-
 		float stolen_attributes;
 
 		float stolen_health;
@@ -71,6 +75,9 @@ namespace Gts {
 			ActorData* GetActorData(Actor* actor);
 			ActorData* GetData(TESObjectREFR* refr);
 			ActorData* GetData(TESObjectREFR& refr);
+			// Uses the handle cached on the record, falls back to a lookup by FormID
+			ActorData* GetData(const ActorRecord& record);
+			SlotHandle GetHandle(TESObjectREFR* refr) const;
 
 
 
@@ -156,6 +163,7 @@ namespace Gts {
 			Persistent() = default;
 
 			mutable std::mutex _lock;
-			std::unordered_map<FormID, ActorData> _actor_data;
+			// Only taken to add/remove actors, lookups are lock free
+			FormSlotMap<ActorData> _actor_data;
 	};
 }
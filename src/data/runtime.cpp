@@ -24,6 +24,13 @@ namespace {
 		return dataHandler ? dataHandler->LookupForm<T>(relativeID, plugin) : nullptr;
 	}
 
+	template <class T>
+	void AddForm(Gts::RuntimeTable<T>& table, std::string_view table_name, const std::string& key, T* form) {
+		if (!table.Add(key, form)) {
+			log::error("{} tag {} is duplicated or collides with another tag", table_name, key);
+		}
+	}
+
 	struct RuntimeConfig {
 		std::unordered_map<std::string, std::string> sounds;
 		std::unordered_map<std::string, std::string> spellEffects;
@@ -68,22 +75,19 @@ namespace Gts {
 	}
 
 	// Sound
-	BSISoundDescriptor* Runtime::GetSound(const std::string_view& tag) {
-		BSISoundDescriptor* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().sounds.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("sond", tag)) {
-				log::warn("Sound: {} not found", tag);
+	BSISoundDescriptor* Runtime::GetSound(const RuntimeTag& tag) {
+		BSISoundDescriptor* data = Runtime::GetSingleton().sounds.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("sond", tag.name)) {
+				log::warn("Sound: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
-	void Runtime::PlaySound(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency) {
+	void Runtime::PlaySound(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency) {
 		auto soundDescriptor = Runtime::GetSound(tag);
 		if (!soundDescriptor) {
-			log::error("Sound invalid: {}", tag);
+			log::error("Sound invalid: {}", tag.name);
 			return;
 		}
 		auto audioManager = BSAudioManager::GetSingleton();
@@ -112,10 +116,10 @@ namespace Gts {
 		}
 	}
 
-	void Runtime::PlaySound(const std::string_view& tag, TESObjectREFR* ref, const float& volume, const float& frequency) {
+	void Runtime::PlaySound(const RuntimeTag& tag, TESObjectREFR* ref, const float& volume, const float& frequency) {
 		auto soundDescriptor = Runtime::GetSound(tag);
 		if (!soundDescriptor) {
-			log::error("Sound invalid: {}", tag);
+			log::error("Sound invalid: {}", tag.name);
 			return;
 		}
 		auto audioManager = BSAudioManager::GetSingleton();
@@ -143,28 +147,28 @@ namespace Gts {
 		}
 	}
 
-	void Runtime::PlaySoundAtNode_FallOff(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, const std::string_view& node, float Falloff) {
+	void Runtime::PlaySoundAtNode_FallOff(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, const std::string_view& node, float Falloff) {
 		Runtime::PlaySoundAtNode_FallOff(tag, actor, volume, frequency, find_node(actor, node), Falloff);
 	}
-	void Runtime::PlaySoundAtNode_FallOff(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject* node, float Falloff) {
+	void Runtime::PlaySoundAtNode_FallOff(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject* node, float Falloff) {
 		if (node) {
 			Runtime::PlaySoundAtNode_FallOff(tag, actor, volume, frequency, *node, Falloff);
 		}
 	}
 
-	void Runtime::PlaySoundAtNode(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, const std::string_view& node) {
+	void Runtime::PlaySoundAtNode(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, const std::string_view& node) {
 		Runtime::PlaySoundAtNode(tag, actor, volume, frequency, find_node(actor, node));
 	}
-	void Runtime::PlaySoundAtNode(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject* node) {
+	void Runtime::PlaySoundAtNode(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject* node) {
 		if (node) {
 			Runtime::PlaySoundAtNode(tag, actor, volume, frequency, *node);
 		}
 	}
 
-	void Runtime::PlaySoundAtNode_FallOff(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject& node, float Falloff) {
+	void Runtime::PlaySoundAtNode_FallOff(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject& node, float Falloff) {
 		auto soundDescriptor = Runtime::GetSound(tag);
 		if (!soundDescriptor) {
-			log::error("Sound invalid: {}", tag);
+			log::error("Sound invalid: {}", tag.name);
 			return;
 		}
 		auto audioManager = BSAudioManager::GetSingleton();
@@ -184,10 +188,10 @@ namespace Gts {
 		}
 	}
 
-	void Runtime::PlaySoundAtNode(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject& node) {
+	void Runtime::PlaySoundAtNode(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject& node) {
 		auto soundDescriptor = Runtime::GetSound(tag);
 		if (!soundDescriptor) {
-			log::error("Sound invalid: {}", tag);
+			log::error("Sound invalid: {}", tag.name);
 			return;
 		}
 		auto audioManager = BSAudioManager::GetSingleton();
@@ -207,24 +211,21 @@ namespace Gts {
 	}
 
 	// Spell Effects
-	EffectSetting* Runtime::GetMagicEffect(const std::string_view& tag) {
-		EffectSetting* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().spellEffects.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			if (!Runtime::Logged("mgef", tag)) {
-				log::warn("MagicEffect: {} not found", tag);
+	EffectSetting* Runtime::GetMagicEffect(const RuntimeTag& tag) {
+		EffectSetting* data = Runtime::GetSingleton().spellEffects.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("mgef", tag.name)) {
+				log::warn("MagicEffect: {} not found", tag.name);
 			}
-			data = nullptr;
 		}
 		return data;
 	}
 
-	bool Runtime::HasMagicEffect(Actor* actor, const std::string_view& tag) {
+	bool Runtime::HasMagicEffect(Actor* actor, const RuntimeTag& tag) {
 		return Runtime::HasMagicEffectOr(actor, tag, false);
 	}
 
-	bool Runtime::HasMagicEffectOr(Actor* actor, const std::string_view& tag, const bool& default_value) {
+	bool Runtime::HasMagicEffectOr(Actor* actor, const RuntimeTag& tag, const bool& default_value) {
 		if (!actor) {
 			return false;
 		}
@@ -237,20 +238,17 @@ namespace Gts {
 	}
 
 	// Spells
-	SpellItem* Runtime::GetSpell(const std::string_view& tag) {
-		SpellItem* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().spells.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			if (!Runtime::Logged("spel", tag)) {
-				log::warn("Spell: {} not found", tag);
+	SpellItem* Runtime::GetSpell(const RuntimeTag& tag) {
+		SpellItem* data = Runtime::GetSingleton().spells.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("spel", tag.name)) {
+				log::warn("Spell: {} not found", tag.name);
 			}
-			data = nullptr;
 		}
 		return data;
 	}
 
-	void Runtime::AddSpell(Actor* actor, const std::string_view& tag) {
+	void Runtime::AddSpell(Actor* actor, const RuntimeTag& tag) {
 		auto data = Runtime::GetSpell(tag);
 		if (data) {
 			if (!Runtime::HasSpell(actor, tag)) {
@@ -258,7 +256,7 @@ namespace Gts {
 			}
 		}
 	}
-	void Runtime::RemoveSpell(Actor* actor, const std::string_view& tag) {
+	void Runtime::RemoveSpell(Actor* actor, const RuntimeTag& tag) {
 		auto data = Runtime::GetSpell(tag);
 		if (data) {
 			if (Runtime::HasSpell(actor, tag)) {
@@ -267,11 +265,11 @@ namespace Gts {
 		}
 	}
 
-	bool Runtime::HasSpell(Actor* actor, const std::string_view& tag) {
+	bool Runtime::HasSpell(Actor* actor, const RuntimeTag& tag) {
 		return Runtime::HasSpellOr(actor, tag, false);
 	}
 
-	bool Runtime::HasSpellOr(Actor* actor, const std::string_view& tag, const bool& default_value) {
+	bool Runtime::HasSpellOr(Actor* actor, const RuntimeTag& tag, const bool& default_value) {
 		auto data = Runtime::GetSpell(tag);
 		if (data) {
 			return actor->HasSpell(data);
@@ -280,7 +278,7 @@ namespace Gts {
 		}
 	}
 
-	void Runtime::CastSpell(Actor* caster, Actor* target, const std::string_view& tag) {
+	void Runtime::CastSpell(Actor* caster, Actor* target, const RuntimeTag& tag) {
 		auto data = GetSpell(tag);
 		if (data) {
 			caster->GetMagicCaster(RE::MagicSystem::CastingSource::kInstant)->CastSpellImmediate(data, false, target, 1.00f, false, 0.0f, caster);
@@ -288,20 +286,17 @@ namespace Gts {
 	}
 
 	// Perks
-	BGSPerk* Runtime::GetPerk(const std::string_view& tag) {
-		BGSPerk* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().perks.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("perk", tag)) {
-				log::warn("Perk: {} not found", tag);
+	BGSPerk* Runtime::GetPerk(const RuntimeTag& tag) {
+		BGSPerk* data = Runtime::GetSingleton().perks.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("perk", tag.name)) {
+				log::warn("Perk: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
 
-	void Runtime::AddPerk(Actor* actor, const std::string_view& tag) {
+	void Runtime::AddPerk(Actor* actor, const RuntimeTag& tag) {
 		auto data = Runtime::GetPerk(tag);
 		if (data) {
 			if (!Runtime::HasPerk(actor, tag)) {
@@ -309,7 +304,7 @@ namespace Gts {
 			}
 		}
 	}
-	void Runtime::RemovePerk(Actor* actor, const std::string_view& tag) {
+	void Runtime::RemovePerk(Actor* actor, const RuntimeTag& tag) {
 		auto data = Runtime::GetPerk(tag);
 		if (data) {
 			if (Runtime::HasPerk(actor, tag)) {
@@ -318,11 +313,11 @@ namespace Gts {
 		}
 	}
 
-	bool Runtime::HasPerk(Actor* actor, const std::string_view& tag) {
+	bool Runtime::HasPerk(Actor* actor, const RuntimeTag& tag) {
 		return Runtime::HasPerkOr(actor, tag, false);
 	}
 
-	bool Runtime::HasPerkOr(Actor* actor, const std::string_view& tag, const bool& default_value) {
+	bool Runtime::HasPerkOr(Actor* actor, const RuntimeTag& tag, const bool& default_value) {
 		auto data = Runtime::GetPerk(tag);
 		if (data) {
 			return actor->HasPerk(data);
@@ -332,26 +327,23 @@ namespace Gts {
 	}
 
 	// Explosion
-	BGSExplosion* Runtime::GetExplosion(const std::string_view& tag) {
-		BGSExplosion* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().explosions.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("expl", tag)) {
-				log::warn("Explosion: {} not found", tag);
+	BGSExplosion* Runtime::GetExplosion(const RuntimeTag& tag) {
+		BGSExplosion* data = Runtime::GetSingleton().explosions.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("expl", tag.name)) {
+				log::warn("Explosion: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
 
-	void Runtime::CreateExplosion(Actor* actor, const float& scale, const std::string_view& tag) {
+	void Runtime::CreateExplosion(Actor* actor, const float& scale, const RuntimeTag& tag) {
 		if (actor) {
 			CreateExplosionAtPos(actor, actor->GetPosition(), scale, tag);
 		}
 	}
 
-	void Runtime::CreateExplosionAtNode(Actor* actor, const std::string_view& node_name, const float& scale, const std::string_view& tag) {
+	void Runtime::CreateExplosionAtNode(Actor* actor, const std::string_view& node_name, const float& scale, const RuntimeTag& tag) {
 		if (actor) {
 			if (actor->Is3DLoaded()) {
 				auto model = actor->GetCurrent3D();
@@ -365,7 +357,7 @@ namespace Gts {
 		}
 	}
 
-	void Runtime::CreateExplosionAtPos(Actor* actor, NiPoint3 pos, const float& scale, const std::string_view& tag) {
+	void Runtime::CreateExplosionAtPos(Actor* actor, NiPoint3 pos, const float& scale, const RuntimeTag& tag) {
 		auto data = GetExplosion(tag);
 		if (data) {
 			NiPointer<TESObjectREFR> instance_ptr = actor->PlaceObjectAtMe(data, false);
@@ -388,24 +380,21 @@ namespace Gts {
 	}
 
 	// Globals
-	TESGlobal* Runtime::GetGlobal(const std::string_view& tag) {
-		TESGlobal* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().globals.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("glob", tag)) {
-				log::warn("Global: {} not found", tag);
+	TESGlobal* Runtime::GetGlobal(const RuntimeTag& tag) {
+		TESGlobal* data = Runtime::GetSingleton().globals.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("glob", tag.name)) {
+				log::warn("Global: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
 
-	bool Runtime::GetBool(const std::string_view& tag) {
+	bool Runtime::GetBool(const RuntimeTag& tag) {
 		return Runtime::GetBoolOr(tag, false);
 	}
 
-	bool Runtime::GetBoolOr(const std::string_view& tag, const bool& default_value) {
+	bool Runtime::GetBoolOr(const RuntimeTag& tag, const bool& default_value) {
 		auto data = GetGlobal(tag);
 		if (data) {
 			return fabs(data->value - 0.0f) > 1e-4;
@@ -414,7 +403,7 @@ namespace Gts {
 		}
 	}
 
-	void Runtime::SetBool(const std::string_view& tag, const bool& value) {
+	void Runtime::SetBool(const RuntimeTag& tag, const bool& value) {
 		auto data = GetGlobal(tag);
 		if (data) {
 			if (value) {
@@ -425,11 +414,11 @@ namespace Gts {
 		}
 	}
 
-	int Runtime::GetInt(const std::string_view& tag) {
+	int Runtime::GetInt(const RuntimeTag& tag) {
 		return Runtime::GetIntOr(tag, false);
 	}
 
-	int Runtime::GetIntOr(const std::string_view& tag, const int& default_value) {
+	int Runtime::GetIntOr(const RuntimeTag& tag, const int& default_value) {
 		auto data = GetGlobal(tag);
 		if (data) {
 			return static_cast<int>(data->value);
@@ -438,18 +427,18 @@ namespace Gts {
 		}
 	}
 
-	void Runtime::SetInt(const std::string_view& tag, const int& value) {
+	void Runtime::SetInt(const RuntimeTag& tag, const int& value) {
 		auto data = GetGlobal(tag);
 		if (data) {
 			data->value = static_cast<float>(value);
 		}
 	}
 
-	float Runtime::GetFloat(const std::string_view& tag) {
+	float Runtime::GetFloat(const RuntimeTag& tag) {
 		return Runtime::GetFloatOr(tag, false);
 	}
 
-	float Runtime::GetFloatOr(const std::string_view& tag, const float& default_value) {
+	float Runtime::GetFloatOr(const RuntimeTag& tag, const float& default_value) {
 		auto data = GetGlobal(tag);
 		if (data) {
 			return data->value;
@@ -458,7 +447,7 @@ namespace Gts {
 		}
 	}
 
-	void Runtime::SetFloat(const std::string_view& tag, const float& value) {
+	void Runtime::SetFloat(const RuntimeTag& tag, const float& value) {
 		auto data = GetGlobal(tag);
 		if (data) {
 			data->value = value;
@@ -466,24 +455,21 @@ namespace Gts {
 	}
 
 	// Quests
-	TESQuest* Runtime::GetQuest(const std::string_view& tag) {
-		TESQuest* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().quests.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("qust", tag)) {
-				log::warn("Quest: {} not found", tag);
+	TESQuest* Runtime::GetQuest(const RuntimeTag& tag) {
+		TESQuest* data = Runtime::GetSingleton().quests.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("qust", tag.name)) {
+				log::warn("Quest: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
 
-	std::uint16_t Runtime::GetStage(const std::string_view& tag) {
+	std::uint16_t Runtime::GetStage(const RuntimeTag& tag) {
 		return Runtime::GetStageOr(tag, 0);
 	}
 
-	std::uint16_t Runtime::GetStageOr(const std::string_view& tag, const std::uint16_t& default_value) {
+	std::uint16_t Runtime::GetStageOr(const RuntimeTag& tag, const std::uint16_t& default_value) {
 		auto data = GetQuest(tag);
 		if (data) {
 			return data->GetCurrentStageID();
@@ -493,22 +479,16 @@ namespace Gts {
 	}
 
 	// Factions
-	TESFaction* Runtime::GetFaction(const std::string_view& tag) {
-		TESFaction* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().factions.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-		}
-		return data;
+	TESFaction* Runtime::GetFaction(const RuntimeTag& tag) {
+		return Runtime::GetSingleton().factions.Find(tag);
 	}
 
 
-	bool Runtime::InFaction(Actor* actor, const std::string_view& tag) {
+	bool Runtime::InFaction(Actor* actor, const RuntimeTag& tag) {
 		return Runtime::InFactionOr(actor, tag, false);
 	}
 
-	bool Runtime::InFactionOr(Actor* actor, const std::string_view& tag, const bool& default_value) {
+	bool Runtime::InFactionOr(Actor* actor, const RuntimeTag& tag, const bool& default_value) {
 		auto data = GetFaction(tag);
 		if (data) {
 			return actor->IsInFaction(data);
@@ -518,19 +498,16 @@ namespace Gts {
 	}
 
 	// Impacts
-	BGSImpactDataSet* Runtime::GetImpactEffect(const std::string_view& tag) {
-		BGSImpactDataSet* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().impacts.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("impc", tag)) {
-				log::warn("ImpactEffect: {} not found", tag);
+	BGSImpactDataSet* Runtime::GetImpactEffect(const RuntimeTag& tag) {
+		BGSImpactDataSet* data = Runtime::GetSingleton().impacts.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("impc", tag.name)) {
+				log::warn("ImpactEffect: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
-	void Runtime::PlayImpactEffect(Actor* actor, const std::string_view& tag, const std::string_view& node, NiPoint3 pick_direction, const float& length, const bool& applyRotation, const bool& useLocalRotation) {
+	void Runtime::PlayImpactEffect(Actor* actor, const RuntimeTag& tag, const std::string_view& node, NiPoint3 pick_direction, const float& length, const bool& applyRotation, const bool& useLocalRotation) {
 		auto data = GetImpactEffect(tag);
 		if (data) {
 			auto impact = BGSImpactManager::GetSingleton();
@@ -539,19 +516,16 @@ namespace Gts {
 	}
 
 	// Races
-	TESRace* Runtime::GetRace(const std::string_view& tag) {
-		TESRace* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().races.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("impc", tag)) {
-				log::warn("Race: {} not found", tag);
+	TESRace* Runtime::GetRace(const RuntimeTag& tag) {
+		TESRace* data = Runtime::GetSingleton().races.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("impc", tag.name)) {
+				log::warn("Race: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
-	bool Runtime::IsRace(Actor* actor, const std::string_view& tag) {
+	bool Runtime::IsRace(Actor* actor, const RuntimeTag& tag) {
 		auto data = GetRace(tag);
 		if (data) {
 			return actor->GetRace() == data;
@@ -561,19 +535,16 @@ namespace Gts {
 	}
 
 	// Keywords
-	BGSKeyword* Runtime::GetKeyword(const std::string_view& tag) {
-		BGSKeyword* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().keywords.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("kywd", tag)) {
-				log::warn("Keyword: {} not found", tag);
+	BGSKeyword* Runtime::GetKeyword(const RuntimeTag& tag) {
+		BGSKeyword* data = Runtime::GetSingleton().keywords.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("kywd", tag.name)) {
+				log::warn("Keyword: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
-	bool Runtime::HasKeyword(Actor* actor, const std::string_view& tag) {
+	bool Runtime::HasKeyword(Actor* actor, const RuntimeTag& tag) {
 		auto data = GetKeyword(tag);
 		if (data) {
 			return actor->HasKeyword(data);
@@ -583,48 +554,42 @@ namespace Gts {
 	}
 
 	// Items
-	TESLevItem* Runtime::GetLeveledItem(const std::string_view& tag) {
-		TESLevItem* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().levelitems.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("cont", tag)) {
-				log::warn("Item: {} not found", tag);
+	TESLevItem* Runtime::GetLeveledItem(const RuntimeTag& tag) {
+		TESLevItem* data = Runtime::GetSingleton().levelitems.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("cont", tag.name)) {
+				log::warn("Item: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
 
 	// Containers
-	TESObjectCONT* Runtime::GetContainer(const std::string_view& tag) {
-		TESObjectCONT* data = nullptr;
-		try {
-			data = Runtime::GetSingleton().containers.at(std::string(tag)).data;
-		}  catch (const std::out_of_range& oor) {
-			data = nullptr;
-			if (!Runtime::Logged("cont", tag)) {
-				log::warn("Container: {} not found", tag);
+	TESObjectCONT* Runtime::GetContainer(const RuntimeTag& tag) {
+		TESObjectCONT* data = Runtime::GetSingleton().containers.Find(tag);
+		if (!data) {
+			if (!Runtime::Logged("cont", tag.name)) {
+				log::warn("Container: {} not found", tag.name);
 			}
 		}
 		return data;
 	}
 
-	TESObjectREFR* Runtime::PlaceContainer(Actor* actor, const std::string_view& tag) {
+	TESObjectREFR* Runtime::PlaceContainer(Actor* actor, const RuntimeTag& tag) {
 		if (actor) {
 			return PlaceContainerAtPos(actor, actor->GetPosition(), tag);
 		}
 		return nullptr;
 	}
 
-	TESObjectREFR* Runtime::PlaceContainer(TESObjectREFR* object, const std::string_view& tag) {
+	TESObjectREFR* Runtime::PlaceContainer(TESObjectREFR* object, const RuntimeTag& tag) {
 		if (object) {
 			return PlaceContainerAtPos(object, object->GetPosition(), tag);
 		}
 		return nullptr;
 	}
 
-	TESObjectREFR* Runtime::PlaceContainerAtPos(Actor* actor, NiPoint3 pos, const std::string_view& tag) {
+	TESObjectREFR* Runtime::PlaceContainerAtPos(Actor* actor, NiPoint3 pos, const RuntimeTag& tag) {
 		auto data = GetContainer(tag);
 		if (data) {
 			NiPointer<TESObjectREFR> instance_ptr = actor->PlaceObjectAtMe(data, false);
@@ -644,7 +609,7 @@ namespace Gts {
 		return nullptr;
 	}
 
-	TESObjectREFR* Runtime::PlaceContainerAtPos(TESObjectREFR* object, NiPoint3 pos, const std::string_view& tag) {
+	TESObjectREFR* Runtime::PlaceContainerAtPos(TESObjectREFR* object, NiPoint3 pos, const RuntimeTag& tag) {
 		auto data = GetContainer(tag);
 		if (data) {
 			NiPointer<TESObjectREFR> instance_ptr = object->PlaceObjectAtMe(data, false);
@@ -665,11 +630,11 @@ namespace Gts {
 	}
 
 	// Team Functions
-	bool Runtime::HasMagicEffectTeam(Actor* actor, const std::string_view& tag) {
+	bool Runtime::HasMagicEffectTeam(Actor* actor, const RuntimeTag& tag) {
 		return Runtime::HasMagicEffectTeamOr(actor, tag, false);
 	}
 
-	bool Runtime::HasMagicEffectTeamOr(Actor* actor, const std::string_view& tag, const bool& default_value) {
+	bool Runtime::HasMagicEffectTeamOr(Actor* actor, const RuntimeTag& tag, const bool& default_value) {
 		if (Runtime::HasMagicEffectOr(actor, tag, default_value)) {
 			return true;
 		}
@@ -681,11 +646,11 @@ namespace Gts {
 		}
 	}
 
-	bool Runtime::HasSpellTeam(Actor* actor, const std::string_view& tag) {
+	bool Runtime::HasSpellTeam(Actor* actor, const RuntimeTag& tag) {
 		return Runtime::HasMagicEffectTeamOr(actor, tag, false);
 	}
 
-	bool Runtime::HasSpellTeamOr(Actor* actor, const std::string_view& tag, const bool& default_value) {
+	bool Runtime::HasSpellTeamOr(Actor* actor, const RuntimeTag& tag, const bool& default_value) {
 		if (Runtime::HasSpellTeam(actor, tag)) {
 			return true;
 		}
@@ -697,11 +662,11 @@ namespace Gts {
 		}
 	}
 
-	bool Runtime::HasPerkTeam(Actor* actor, const std::string_view& tag) {
+	bool Runtime::HasPerkTeam(Actor* actor, const RuntimeTag& tag) {
 		return Runtime::HasPerkTeamOr(actor, tag, false);
 	}
 
-	bool Runtime::HasPerkTeamOr(Actor* actor, const std::string_view& tag, const bool& default_value) {
+	bool Runtime::HasPerkTeamOr(Actor* actor, const RuntimeTag& tag, const bool& default_value) {
 		if (Runtime::HasPerk(actor, tag)) {
 			return true;
 		}
@@ -715,10 +680,8 @@ namespace Gts {
 
 	bool Runtime::Logged(const std::string_view& catagory, const std::string_view& key) {
 		auto& m = Runtime::GetSingleton().logged;
-		std::string logKey = std::format("{}::{}", catagory, key);
-		bool shouldLog = !(m.find(logKey) == m.end());
-		m.emplace(logKey);
-		return shouldLog;
+		std::uint64_t logKey = RuntimeTag::Hash(key, RuntimeTag::Hash(catagory));
+		return !m.emplace(logKey).second;
 	}
 
 	void Runtime::DataReady() {
@@ -728,7 +691,7 @@ namespace Gts {
 		for (auto &[key, value]: config.sounds) {
 			auto form = find_form<BGSSoundDescriptorForm>(value);
 			if (form) {
-				this->sounds.try_emplace(key, form);
+				AddForm(this->sounds, "sounds", key, form);
 			} else if (!Runtime::Logged("sond", key)) {
 				log::warn("SoundDescriptorform not found for {}", key);
 			}
@@ -737,7 +700,7 @@ namespace Gts {
 		for (auto &[key, value]: config.spellEffects) {
 			auto form = find_form<EffectSetting>(value);
 			if (form) {
-				this->spellEffects.try_emplace(key, form);
+				AddForm(this->spellEffects, "spellEffects", key, form);
 			} else if (!Runtime::Logged("mgef", key)) {
 				log::warn("EffectSetting form not found for {}", key);
 			}
@@ -746,7 +709,7 @@ namespace Gts {
 		for (auto &[key, value]: config.spells) {
 			auto form = find_form<SpellItem>(value);
 			if (form) {
-				this->spells.try_emplace(key, form);
+				AddForm(this->spells, "spells", key, form);
 			} else if (!Runtime::Logged("spel", key)) {
 				log::warn("SpellItem form not found for {}", key);
 			}
@@ -755,7 +718,7 @@ namespace Gts {
 		for (auto &[key, value]: config.perks) {
 			auto form = find_form<BGSPerk>(value);
 			if (form) {
-				this->perks.try_emplace(key, form);
+				AddForm(this->perks, "perks", key, form);
 			} else if (!Runtime::Logged("perk", key)) {
 				log::warn("Perk form not found for {}", key);
 			}
@@ -764,7 +727,7 @@ namespace Gts {
 		for (auto &[key, value]: config.explosions) {
 			auto form = find_form<BGSExplosion>(value);
 			if (form) {
-				this->explosions.try_emplace(key, form);
+				AddForm(this->explosions, "explosions", key, form);
 			} else if (!Runtime::Logged("expl", key)) {
 				log::warn("Explosion form not found for {}", key);
 			}
@@ -773,7 +736,7 @@ namespace Gts {
 		for (auto &[key, value]: config.globals) {
 			auto form = find_form<TESGlobal>(value);
 			if (form) {
-				this->globals.try_emplace(key, form);
+				AddForm(this->globals, "globals", key, form);
 			} else if (!Runtime::Logged("glob", key)) {
 				log::warn("Global form not found for {}", key);
 			}
@@ -782,7 +745,7 @@ namespace Gts {
 		for (auto &[key, value]: config.quests) {
 			auto form = find_form<TESQuest>(value);
 			if (form) {
-				this->quests.try_emplace(key, form);
+				AddForm(this->quests, "quests", key, form);
 			} else if (!Runtime::Logged("qust", key)) {
 				log::warn("Quest form not found for {}", key);
 			}
@@ -791,7 +754,7 @@ namespace Gts {
 		for (auto &[key, value]: config.factions) {
 			auto form = find_form<TESFaction>(value);
 			if (form) {
-				this->factions.try_emplace(key, form);
+				AddForm(this->factions, "factions", key, form);
 			} else if (!Runtime::Logged("facn", key)) {
 				log::warn("FactionData form not found for {}", key);
 			}
@@ -800,7 +763,7 @@ namespace Gts {
 		for (auto &[key, value]: config.impacts) {
 			auto form = find_form<BGSImpactDataSet>(value);
 			if (form) {
-				this->impacts.try_emplace(key, form);
+				AddForm(this->impacts, "impacts", key, form);
 			} else if (!Runtime::Logged("impc", key)) {
 				log::warn("ImpactData form not found for {}", key);
 			}
@@ -809,7 +772,7 @@ namespace Gts {
 		for (auto &[key, value]: config.races) {
 			auto form = find_form<TESRace>(value);
 			if (form) {
-				this->races.try_emplace(key, form);
+				AddForm(this->races, "races", key, form);
 			} else if (!Runtime::Logged("race", key)) {
 				log::warn("RaceData form not found for {}", key);
 			}
@@ -818,7 +781,7 @@ namespace Gts {
 		for (auto &[key, value]: config.keywords) {
 			auto form = find_form<BGSKeyword>(value);
 			if (form) {
-				this->keywords.try_emplace(key, form);
+				AddForm(this->keywords, "keywords", key, form);
 			} else if (!Runtime::Logged("kywd", key)) {
 				log::warn("Keyword form not found for {}", key);
 			}
@@ -827,7 +790,7 @@ namespace Gts {
 		for (auto &[key, value]: config.containers) {
 			auto form = find_form<TESObjectCONT>(value);
 			if (form) {
-				this->containers.try_emplace(key, form);
+				AddForm(this->containers, "containers", key, form);
 			} else if (!Runtime::Logged("cont", key)) {
 				log::warn("Container form not found for {}", key);
 			}
@@ -836,7 +799,7 @@ namespace Gts {
 		for (auto &[key, value]: config.levelitems) {
 			auto form = find_form<TESLevItem>(value);
 			if (form) {
-				this->levelitems.try_emplace(key, form);
+				AddForm(this->levelitems, "levelitems", key, form);
 			} else if (!Runtime::Logged("cont", key)) {
 				log::warn("Item form not found for {}", key);
 			}
@@ -9,161 +9,220 @@ using namespace SKSE;
 using namespace RE;
 
 namespace Gts {
-	struct SoundData {
-		BGSSoundDescriptorForm* data;
+	// Name of a form in GtsRuntime.toml
+	//  String literals are hashed at compile time, other strings are hashed on the call (no allocation)
+	struct RuntimeTag {
+		std::uint64_t hash;
+		std::string_view name;
+
+		template <std::size_t N>
+		consteval RuntimeTag(const char (&literal)[N]) : hash(RuntimeTag::Hash(std::string_view(literal, N - 1))), name(literal, N - 1) {
+		}
+		template <class T> requires (!std::is_array_v<T> && std::is_convertible_v<const T&, std::string_view>)
+		constexpr RuntimeTag(const T& value) : RuntimeTag(std::string_view(value), 0) {
+		}
+
+		// FNV-1a
+		static constexpr std::uint64_t Hash(std::string_view value, std::uint64_t seed = 0xcbf29ce484222325ull) {
+			std::uint64_t result = seed;
+			for (char c: value) {
+				result ^= static_cast<std::uint8_t>(c);
+				result *= 0x100000001b3ull;
+			}
+			return result;
+		}
+
+		private:
+			constexpr RuntimeTag(std::string_view value, int) : hash(RuntimeTag::Hash(value)), name(value) {
+			}
 	};
 
-	struct SpellEffectData {
-		EffectSetting* data;
-	};
-
-	struct SpellData {
-		SpellItem* data;
-	};
-
-	struct PerkData {
-		BGSPerk* data;
-	};
-
-	struct ExplosionData {
-		BGSExplosion* data;
-	};
-
-	struct GlobalData {
-		TESGlobal* data;
-	};
-
-	struct QuestData {
-		TESQuest* data;
-	};
-
-	struct FactionData {
-		TESFaction* data;
-	};
-
-	struct ImpactData {
-		BGSImpactDataSet* data;
-	};
-
-	struct RaceData {
-		TESRace* data;
-	};
-
-	struct KeywordData {
-		BGSKeyword* data;
-	};
-
-	struct ContainerData {
-		TESObjectCONT* data;
-	};
-
-	struct LeveledItemsData {
-		TESLevItem* data;
+	// Forms of one kind, stored densely in the order they were loaded at DataReady
+	//  Lookup is an open addressed probe on the tag hash followed by an array index
+	template <class T>
+	class RuntimeTable {
+		public:
+			// Returns false if the name is already used (or its hash collides with another name)
+			bool Add(std::string_view name, T* form) {
+				std::uint64_t hash = RuntimeTag::Hash(name);
+				if (this->FindId(hash) != INVALID) {
+					return false;
+				}
+				if ((this->forms.size() + 1) * 2 > this->slots.size()) {
+					this->Grow();
+				}
+				std::uint32_t id = static_cast<std::uint32_t>(this->forms.size());
+				this->forms.push_back(form);
+				this->hashes.push_back(hash);
+				this->Insert(hash, id);
+				return true;
+			}
+
+			T* Find(const RuntimeTag& tag) const noexcept {
+				std::uint32_t id = this->FindId(tag.hash);
+				return id == INVALID ? nullptr : this->forms[id];
+			}
+
+			void Clear() {
+				this->forms.clear();
+				this->hashes.clear();
+				this->slots.clear();
+			}
+
+			std::size_t Size() const noexcept {
+				return this->forms.size();
+			}
+
+		private:
+			static constexpr std::uint32_t INVALID = std::numeric_limits<std::uint32_t>::max();
+
+			struct Slot {
+				std::uint64_t hash = 0;
+				std::uint32_t id = INVALID;
+			};
+
+			std::uint32_t FindId(std::uint64_t hash) const noexcept {
+				if (this->slots.empty()) {
+					return INVALID;
+				}
+				std::size_t mask = this->slots.size() - 1;
+				for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+					const Slot& slot = this->slots[i];
+					if (slot.id == INVALID) {
+						return INVALID;
+					}
+					if (slot.hash == hash) {
+						return slot.id;
+					}
+				}
+			}
+
+			void Insert(std::uint64_t hash, std::uint32_t id) {
+				std::size_t mask = this->slots.size() - 1;
+				std::size_t i = hash & mask;
+				while (this->slots[i].id != INVALID) {
+					i = (i + 1) & mask;
+				}
+				this->slots[i] = Slot { .hash = hash, .id = id };
+			}
+
+			void Grow() {
+				this->slots.assign(std::max<std::size_t>(16, this->slots.size() * 2), Slot());
+				for (std::uint32_t id = 0; id < this->hashes.size(); id++) {
+					this->Insert(this->hashes[id], id);
+				}
+			}
+
+			// Indexed by id
+			std::vector<T*> forms;
+			std::vector<std::uint64_t> hashes;
+			// Always a power of two and at most half full
+			std::vector<Slot> slots;
 	};
 
-
 	class Runtime : public EventListener {
 		public:
 			[[nodiscard]] static Runtime& GetSingleton() noexcept;
 
 			virtual std::string DebugName() override;
 			virtual void DataReady() override;
-			static BSISoundDescriptor* GetSound(const std::string_view& tag);
-			static void PlaySound(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency);
-			static void PlaySound(const std::string_view& tag, TESObjectREFR* ref, const float& volume, const float& frequency);
+			static BSISoundDescriptor* GetSound(const RuntimeTag& tag);
+			static void PlaySound(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency);
+			static void PlaySound(const RuntimeTag& tag, TESObjectREFR* ref, const float& volume, const float& frequency);
 
-			static void PlaySoundAtNode_FallOff(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, const std::string_view& node, float Falloff);
-			static void PlaySoundAtNode_FallOff(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject* node, float Falloff);
-			static void PlaySoundAtNode_FallOff(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject& node, float FallOff);
+			static void PlaySoundAtNode_FallOff(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, const std::string_view& node, float Falloff);
+			static void PlaySoundAtNode_FallOff(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject* node, float Falloff);
+			static void PlaySoundAtNode_FallOff(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject& node, float FallOff);
 
-			static void PlaySoundAtNode(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, const std::string_view& node);
-			static void PlaySoundAtNode(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject* node);
-			static void PlaySoundAtNode(const std::string_view& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject& node);
+			static void PlaySoundAtNode(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, const std::string_view& node);
+			static void PlaySoundAtNode(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject* node);
+			static void PlaySoundAtNode(const RuntimeTag& tag, Actor* actor, const float& volume, const float& frequency, NiAVObject& node);
 			// Spell Effects
-			static EffectSetting* GetMagicEffect(const std::string_view& tag);
-			static bool HasMagicEffect(Actor* actor, const std::string_view& tag);
-			static bool HasMagicEffectOr(Actor* actor, const std::string_view& tag, const bool& default_value);
+			static EffectSetting* GetMagicEffect(const RuntimeTag& tag);
+			static bool HasMagicEffect(Actor* actor, const RuntimeTag& tag);
+			static bool HasMagicEffectOr(Actor* actor, const RuntimeTag& tag, const bool& default_value);
 			// Spells
-			static SpellItem* GetSpell(const std::string_view& tag);
-			static void AddSpell(Actor* actor, const std::string_view& tag);
-			static void RemoveSpell(Actor* actor, const std::string_view& tag);
-			static bool HasSpell(Actor* actor, const std::string_view& tag);
-			static bool HasSpellOr(Actor* actor, const std::string_view& tag, const bool& default_value);
-			static void CastSpell(Actor* caster, Actor* target, const std::string_view& tag);
+			static SpellItem* GetSpell(const RuntimeTag& tag);
+			static void AddSpell(Actor* actor, const RuntimeTag& tag);
+			static void RemoveSpell(Actor* actor, const RuntimeTag& tag);
+			static bool HasSpell(Actor* actor, const RuntimeTag& tag);
+			static bool HasSpellOr(Actor* actor, const RuntimeTag& tag, const bool& default_value);
+			static void CastSpell(Actor* caster, Actor* target, const RuntimeTag& tag);
 			// Perks
-			static BGSPerk* GetPerk(const std::string_view& tag);
-			static void AddPerk(Actor* actor, const std::string_view& tag);
-			static void RemovePerk(Actor* actor, const std::string_view& tag);
-			static bool HasPerk(Actor* actor, const std::string_view& tag);
-			static bool HasPerkOr(Actor* actor, const std::string_view& tag, const bool& default_value);
+			static BGSPerk* GetPerk(const RuntimeTag& tag);
+			static void AddPerk(Actor* actor, const RuntimeTag& tag);
+			static void RemovePerk(Actor* actor, const RuntimeTag& tag);
+			static bool HasPerk(Actor* actor, const RuntimeTag& tag);
+			static bool HasPerkOr(Actor* actor, const RuntimeTag& tag, const bool& default_value);
 			// Explosion
-			static BGSExplosion* GetExplosion(const std::string_view& tag);
-			static void CreateExplosion(Actor* actor, const float& scale, const std::string_view& tag);
-			static void CreateExplosionAtNode(Actor* actor, const std::string_view& node, const float& scale, const std::string_view& tag);
-			static void CreateExplosionAtPos(Actor* actor, NiPoint3 pos, const float& scale, const std::string_view& tag);
+			static BGSExplosion* GetExplosion(const RuntimeTag& tag);
+			static void CreateExplosion(Actor* actor, const float& scale, const RuntimeTag& tag);
+			static void CreateExplosionAtNode(Actor* actor, const std::string_view& node, const float& scale, const RuntimeTag& tag);
+			static void CreateExplosionAtPos(Actor* actor, NiPoint3 pos, const float& scale, const RuntimeTag& tag);
 			// Globals
-			static TESGlobal* GetGlobal(const std::string_view& tag);
-			static bool GetBool(const std::string_view& tag);
-			static bool GetBoolOr(const std::string_view& tag, const bool& default_value);
-			static void SetBool(const std::string_view& tag, const bool& value);
-			static int GetInt(const std::string_view& tag);
-			static int GetIntOr(const std::string_view& tag, const int& default_value);
-			static void SetInt(const std::string_view& tag, const int& value);
-			static float GetFloat(const std::string_view& tag);
-			static float GetFloatOr(const std::string_view& tag, const float& default_value);
-			static void SetFloat(const std::string_view& tag, const float& value);
+			static TESGlobal* GetGlobal(const RuntimeTag& tag);
+			static bool GetBool(const RuntimeTag& tag);
+			static bool GetBoolOr(const RuntimeTag& tag, const bool& default_value);
+			static void SetBool(const RuntimeTag& tag, const bool& value);
+			static int GetInt(const RuntimeTag& tag);
+			static int GetIntOr(const RuntimeTag& tag, const int& default_value);
+			static void SetInt(const RuntimeTag& tag, const int& value);
+			static float GetFloat(const RuntimeTag& tag);
+			static float GetFloatOr(const RuntimeTag& tag, const float& default_value);
+			static void SetFloat(const RuntimeTag& tag, const float& value);
 			// Quests
-			static TESQuest* GetQuest(const std::string_view& tag);
-			static std::uint16_t GetStage(const std::string_view& tag);
-			static std::uint16_t GetStageOr(const std::string_view& tag, const std::uint16_t& default_value);
+			static TESQuest* GetQuest(const RuntimeTag& tag);
+			static std::uint16_t GetStage(const RuntimeTag& tag);
+			static std::uint16_t GetStageOr(const RuntimeTag& tag, const std::uint16_t& default_value);
 			// Factions
-			static TESFaction* GetFaction(const std::string_view& tag);
-			static bool InFaction(Actor* actor, const std::string_view& tag);
-			static bool InFactionOr(Actor* actor, const std::string_view& tag, const bool& default_value);
+			static TESFaction* GetFaction(const RuntimeTag& tag);
+			static bool InFaction(Actor* actor, const RuntimeTag& tag);
+			static bool InFactionOr(Actor* actor, const RuntimeTag& tag, const bool& default_value);
 			// Impacts
-			static BGSImpactDataSet* GetImpactEffect(const std::string_view& tag);
-			static void PlayImpactEffect(Actor* actor, const std::string_view& tag, const std::string_view& node, NiPoint3 pick_direction, const float& length, const bool& applyRotation, const bool& useLocalRotation);
+			static BGSImpactDataSet* GetImpactEffect(const RuntimeTag& tag);
+			static void PlayImpactEffect(Actor* actor, const RuntimeTag& tag, const std::string_view& node, NiPoint3 pick_direction, const float& length, const bool& applyRotation, const bool& useLocalRotation);
 			// Races
-			static TESRace* GetRace(const std::string_view& tag);
-			static bool IsRace(Actor* actor, const std::string_view& tag);
+			static TESRace* GetRace(const RuntimeTag& tag);
+			static bool IsRace(Actor* actor, const RuntimeTag& tag);
 			// Keywords
-			static BGSKeyword* GetKeyword(const std::string_view& tag);
-			static bool HasKeyword(Actor* actor, const std::string_view& tag);
+			static BGSKeyword* GetKeyword(const RuntimeTag& tag);
+			static bool HasKeyword(Actor* actor, const RuntimeTag& tag);
 
 			// Leveled Items
-			static TESLevItem* GetLeveledItem(const std::string_view& tag);
+			static TESLevItem* GetLeveledItem(const RuntimeTag& tag);
 			// Containers
-			static TESObjectCONT* GetContainer(const std::string_view& tag);
-			static TESObjectREFR* PlaceContainer(Actor* actor, const std::string_view& tag);
-			static TESObjectREFR* PlaceContainer(TESObjectREFR* object, const std::string_view& tag);
-			static TESObjectREFR* PlaceContainerAtPos(Actor* actor, NiPoint3 pos, const std::string_view& tag);
-			static TESObjectREFR* PlaceContainerAtPos(TESObjectREFR* object, NiPoint3 pos, const std::string_view& tag);
+			static TESObjectCONT* GetContainer(const RuntimeTag& tag);
+			static TESObjectREFR* PlaceContainer(Actor* actor, const RuntimeTag& tag);
+			static TESObjectREFR* PlaceContainer(TESObjectREFR* object, const RuntimeTag& tag);
+			static TESObjectREFR* PlaceContainerAtPos(Actor* actor, NiPoint3 pos, const RuntimeTag& tag);
+			static TESObjectREFR* PlaceContainerAtPos(TESObjectREFR* object, NiPoint3 pos, const RuntimeTag& tag);
 
 			// Team Functions
-			static bool HasMagicEffectTeam(Actor* actor, const std::string_view& tag);
-			static bool HasMagicEffectTeamOr(Actor* actor, const std::string_view& tag, const bool& default_value);
-			static bool HasSpellTeam(Actor* actor, const std::string_view& tag);
-			static bool HasSpellTeamOr(Actor* actor, const std::string_view& tag, const bool& default_value);
-			static bool HasPerkTeam(Actor* actor, const std::string_view& tag);
-			static bool HasPerkTeamOr(Actor* actor, const std::string_view& tag, const bool& default_value);
+			static bool HasMagicEffectTeam(Actor* actor, const RuntimeTag& tag);
+			static bool HasMagicEffectTeamOr(Actor* actor, const RuntimeTag& tag, const bool& default_value);
+			static bool HasSpellTeam(Actor* actor, const RuntimeTag& tag);
+			static bool HasSpellTeamOr(Actor* actor, const RuntimeTag& tag, const bool& default_value);
+			static bool HasPerkTeam(Actor* actor, const RuntimeTag& tag);
+			static bool HasPerkTeamOr(Actor* actor, const RuntimeTag& tag, const bool& default_value);
 
 			// Log function
 			static bool Logged(const std::string_view& catagory, const std::string_view& key);
 
-			std::unordered_map<std::string, SoundData> sounds;
-			std::unordered_map<std::string, SpellEffectData> spellEffects;
-			std::unordered_map<std::string, SpellData> spells;
-			std::unordered_map<std::string, PerkData> perks;
-			std::unordered_map<std::string, ExplosionData> explosions;
-			std::unordered_map<std::string, GlobalData> globals;
-			std::unordered_map<std::string, QuestData> quests;
-			std::unordered_map<std::string, FactionData> factions;
-			std::unordered_map<std::string, ImpactData> impacts;
-			std::unordered_map<std::string, RaceData> races;
-			std::unordered_map<std::string, KeywordData> keywords;
-			std::unordered_map<std::string, ContainerData> containers;
-			std::unordered_map<std::string, LeveledItemsData> levelitems;
-
-			std::unordered_set<std::string> logged;
+			RuntimeTable<BGSSoundDescriptorForm> sounds;
+			RuntimeTable<EffectSetting> spellEffects;
+			RuntimeTable<SpellItem> spells;
+			RuntimeTable<BGSPerk> perks;
+			RuntimeTable<BGSExplosion> explosions;
+			RuntimeTable<TESGlobal> globals;
+			RuntimeTable<TESQuest> quests;
+			RuntimeTable<TESFaction> factions;
+			RuntimeTable<BGSImpactDataSet> impacts;
+			RuntimeTable<TESRace> races;
+			RuntimeTable<BGSKeyword> keywords;
+			RuntimeTable<TESObjectCONT> containers;
+			RuntimeTable<TESLevItem> levelitems;
+
+			// Hash of catagory + key
+			std::unordered_set<std::uint64_t> logged;
 	};
 }
@@ -0,0 +1,317 @@
+#pragma once
+// Generational slot map of per actor data keyed by FormID
+//  Values live in fixed chunks and never move, a pointer stays valid until its key is erased
+//  Find/Get never lock and are safe while another thread inserts, writers must be serialized by the owner
+//  Erased slots are reused, the generation in a SlotHandle tells if it still refers to the same entry
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+	struct SlotHandle {
+		static constexpr std::uint32_t INVALID = std::numeric_limits<std::uint32_t>::max();
+		std::uint32_t index = INVALID;
+		// Odd while the slot is in use, bumped on every insert and erase
+		std::uint32_t generation = 0;
+
+		bool IsValid() const {
+			return this->index != INVALID;
+		}
+	};
+
+	template <class T>
+	class FormSlotMap {
+		public:
+			static constexpr std::size_t CHUNK_SIZE = 256;
+			static constexpr std::size_t MAX_CHUNKS = 256;
+
+			FormSlotMap() = default;
+			FormSlotMap(const FormSlotMap&) = delete;
+			FormSlotMap& operator=(const FormSlotMap&) = delete;
+
+			~FormSlotMap() {
+				for (auto& chunk: this->chunks) {
+					delete chunk.load();
+				}
+			}
+
+			T* Find(FormID key) const noexcept {
+				return this->Get(this->FindHandle(key));
+			}
+
+			T* Get(const SlotHandle& handle) const noexcept {
+				Slot* slot = this->GetSlot(handle.index);
+				if (!slot || slot->generation.load(std::memory_order_acquire) != handle.generation) {
+					return nullptr;
+				}
+				return &(*slot->value);
+			}
+
+			SlotHandle FindHandle(FormID key) const noexcept {
+				std::uint32_t index = this->FindIndex(key);
+				Slot* slot = this->GetSlot(index);
+				if (!slot) {
+					return SlotHandle();
+				}
+				std::uint32_t generation = slot->generation.load(std::memory_order_acquire);
+				if ((generation & 1) == 0) {
+					return SlotHandle();
+				}
+				return SlotHandle { .index = index, .generation = generation };
+			}
+
+			// Returns the existing value if the key is already used
+			template <class... Args>
+			std::pair<T*, bool> TryEmplace(FormID key, Args&&... args) {
+				T* existing = this->Find(key);
+				if (existing) {
+					return { existing, false };
+				}
+				if (key == 0) {
+					return { nullptr, false };
+				}
+				std::uint32_t index = this->AllocSlot();
+				if (index == SlotHandle::INVALID) {
+					log::error("FormSlotMap is full, can't add {:X}", key);
+					return { nullptr, false };
+				}
+				Slot* slot = this->GetSlot(index);
+				slot->value.emplace(std::forward<Args>(args)...);
+				slot->key = key;
+				slot->generation.fetch_add(1, std::memory_order_release);
+				this->IndexInsert(key, index);
+				this->size += 1;
+				return { &(*slot->value), true };
+			}
+
+			T* InsertOrAssign(FormID key, const T& value) {
+				auto [result, inserted] = this->TryEmplace(key, value);
+				if (result && !inserted) {
+					*result = value;
+				}
+				return result;
+			}
+
+			bool Erase(FormID key) {
+				std::uint32_t index = this->IndexErase(key);
+				Slot* slot = this->GetSlot(index);
+				if (!slot) {
+					return false;
+				}
+				slot->generation.fetch_add(1, std::memory_order_release);
+				slot->value.reset();
+				this->freeSlots.push_back(index);
+				this->size -= 1;
+				return true;
+			}
+
+			void Clear() {
+				for (std::uint32_t index = 0; index < this->nextSlot; index++) {
+					Slot* slot = this->GetSlot(index);
+					if (slot->generation.load(std::memory_order_relaxed) & 1) {
+						slot->generation.fetch_add(1, std::memory_order_release);
+						slot->value.reset();
+					}
+				}
+				// Generations are kept so old handles stay invalid
+				this->freeSlots.clear();
+				for (std::uint32_t index = this->nextSlot; index > 0; index--) {
+					this->freeSlots.push_back(index - 1);
+				}
+				this->size = 0;
+
+				Index* current = this->index.load(std::memory_order_relaxed);
+				if (current) {
+					for (std::size_t i = 0; i <= current->mask; i++) {
+						current->entries[i].store(EMPTY, std::memory_order_release);
+					}
+					current->used = 0;
+				}
+				// Nobody can still be probing a table from before the last reset
+				std::erase_if(this->retired, [current](const auto& table) {
+					return table.get() != current;
+				});
+			}
+
+			std::size_t Size() const noexcept {
+				return this->size;
+			}
+
+			// Iterates the used slots, dereferences to (key, value)
+			class iterator {
+				public:
+					iterator(const FormSlotMap* map, std::uint32_t index) : map(map), index(index) {
+						this->Skip();
+					}
+					std::pair<FormID, T&> operator*() const {
+						Slot* slot = this->map->GetSlot(this->index);
+						return { slot->key, *slot->value };
+					}
+					iterator& operator++() {
+						this->index += 1;
+						this->Skip();
+						return *this;
+					}
+					bool operator!=(const iterator& other) const {
+						return this->index != other.index;
+					}
+				private:
+					void Skip() {
+						while (this->index < this->map->nextSlot && (this->map->GetSlot(this->index)->generation.load(std::memory_order_relaxed) & 1) == 0) {
+							this->index += 1;
+						}
+					}
+					const FormSlotMap* map;
+					std::uint32_t index;
+			};
+			iterator begin() const {
+				return iterator(this, 0);
+			}
+			iterator end() const {
+				return iterator(this, this->nextSlot);
+			}
+
+		private:
+			// Entries are key << 32 | slot index
+			static constexpr std::uint64_t EMPTY = 0;
+			static constexpr std::uint64_t TOMBSTONE = std::numeric_limits<std::uint64_t>::max();
+
+			struct Slot {
+				std::optional<T> value;
+				FormID key = 0;
+				std::atomic<std::uint32_t> generation = 0;
+			};
+			struct Chunk {
+				std::array<Slot, CHUNK_SIZE> slots;
+			};
+			// Open addressed, at most half full including tombstones
+			struct Index {
+				std::size_t mask;
+				std::size_t used = 0;
+				std::unique_ptr<std::atomic<std::uint64_t>[]> entries;
+
+				explicit Index(std::size_t capacity) : mask(capacity - 1), entries(std::make_unique<std::atomic<std::uint64_t>[]>(capacity)) {
+				}
+			};
+
+			static std::size_t Hash(FormID key) {
+				return static_cast<std::size_t>((static_cast<std::uint64_t>(key) * 11400714819323198485ull) >> 32);
+			}
+
+			Slot* GetSlot(std::uint32_t index) const noexcept {
+				if (index == SlotHandle::INVALID) {
+					return nullptr;
+				}
+				Chunk* chunk = this->chunks[index / CHUNK_SIZE].load(std::memory_order_acquire);
+				if (!chunk) {
+					return nullptr;
+				}
+				return &chunk->slots[index % CHUNK_SIZE];
+			}
+
+			std::uint32_t AllocSlot() {
+				if (!this->freeSlots.empty()) {
+					std::uint32_t index = this->freeSlots.back();
+					this->freeSlots.pop_back();
+					return index;
+				}
+				if (this->nextSlot >= CHUNK_SIZE * MAX_CHUNKS) {
+					return SlotHandle::INVALID;
+				}
+				std::uint32_t index = this->nextSlot;
+				auto& chunk = this->chunks[index / CHUNK_SIZE];
+				if (!chunk.load(std::memory_order_relaxed)) {
+					chunk.store(new Chunk(), std::memory_order_release);
+				}
+				this->nextSlot += 1;
+				return index;
+			}
+
+			std::uint32_t FindIndex(FormID key) const noexcept {
+				Index* current = this->index.load(std::memory_order_acquire);
+				if (!current || key == 0) {
+					return SlotHandle::INVALID;
+				}
+				for (std::size_t i = Hash(key) & current->mask;; i = (i + 1) & current->mask) {
+					std::uint64_t entry = current->entries[i].load(std::memory_order_acquire);
+					if (entry == EMPTY) {
+						return SlotHandle::INVALID;
+					}
+					if (entry != TOMBSTONE && static_cast<FormID>(entry >> 32) == key) {
+						return static_cast<std::uint32_t>(entry);
+					}
+				}
+			}
+
+			void IndexInsert(FormID key, std::uint32_t slot) {
+				Index* current = this->index.load(std::memory_order_relaxed);
+				if (!current || (current->used + 1) * 2 > current->mask + 1) {
+					current = this->Rehash();
+				}
+				std::uint64_t entry = (static_cast<std::uint64_t>(key) << 32) | slot;
+				for (std::size_t i = Hash(key) & current->mask;; i = (i + 1) & current->mask) {
+					std::uint64_t existing = current->entries[i].load(std::memory_order_relaxed);
+					if (existing == EMPTY || existing == TOMBSTONE) {
+						if (existing == EMPTY) {
+							current->used += 1;
+						}
+						current->entries[i].store(entry, std::memory_order_release);
+						return;
+					}
+				}
+			}
+
+			std::uint32_t IndexErase(FormID key) {
+				Index* current = this->index.load(std::memory_order_relaxed);
+				if (!current || key == 0) {
+					return SlotHandle::INVALID;
+				}
+				for (std::size_t i = Hash(key) & current->mask;; i = (i + 1) & current->mask) {
+					std::uint64_t entry = current->entries[i].load(std::memory_order_relaxed);
+					if (entry == EMPTY) {
+						return SlotHandle::INVALID;
+					}
+					if (entry != TOMBSTONE && static_cast<FormID>(entry >> 32) == key) {
+						// Readers keep probing past tombstones so they never miss a live key
+						current->entries[i].store(TOMBSTONE, std::memory_order_release);
+						return static_cast<std::uint32_t>(entry);
+					}
+				}
+			}
+
+			// A new table is published and the old one is kept alive for readers still probing it
+			Index* Rehash() {
+				std::size_t capacity = std::bit_ceil(std::max<std::size_t>(16, (this->size + 1) * 4));
+				auto& table = this->retired.emplace_back(std::make_unique<Index>(capacity));
+				Index* next = table.get();
+				Index* current = this->index.load(std::memory_order_relaxed);
+				if (current) {
+					for (std::size_t i = 0; i <= current->mask; i++) {
+						std::uint64_t entry = current->entries[i].load(std::memory_order_relaxed);
+						if (entry == EMPTY || entry == TOMBSTONE) {
+							continue;
+						}
+						for (std::size_t j = Hash(static_cast<FormID>(entry >> 32)) & next->mask;; j = (j + 1) & next->mask) {
+							if (next->entries[j].load(std::memory_order_relaxed) == EMPTY) {
+								next->entries[j].store(entry, std::memory_order_relaxed);
+								next->used += 1;
+								break;
+							}
+						}
+					}
+				}
+				this->index.store(next, std::memory_order_release);
+				return next;
+			}
+
+			std::array<std::atomic<Chunk*>, MAX_CHUNKS> chunks = {};
+			std::uint32_t nextSlot = 0;
+			std::vector<std::uint32_t> freeSlots;
+			std::size_t size = 0;
+
+			std::atomic<Index*> index = nullptr;
+			// Owns every table published to index, including the current one
+			std::vector<std::unique_ptr<Index>> retired;
+	};
+}
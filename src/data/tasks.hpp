@@ -15,19 +15,111 @@ namespace Gts {
 		Papyrus,
 	};
 
-	class BaseTask {
+	// Move only callable that keeps small captures inline
+	//  Lambdas larger than Capacity fall back to a heap allocation
+	template <class Signature, std::size_t Capacity = 96>
+	class InlineFunction;
+
+	template <class R, class... Args, std::size_t Capacity>
+	class InlineFunction<R(Args...), Capacity> {
 		public:
-			virtual bool Update() = 0;
-			UpdateKind UpdateOn() {
-				return this->updateOnKind;
+			InlineFunction() = default;
+
+			template <class F> requires (!std::is_same_v<std::decay_t<F>, InlineFunction>)
+			InlineFunction(F&& f) {
+				using Fn = std::decay_t<F>;
+				if constexpr (InlineFunction::FitsInline<Fn>()) {
+					new (this->storage) Fn(std::forward<F>(f));
+					this->ops = &InlineFunction::InlineOps<Fn>;
+				} else {
+					*reinterpret_cast<Fn**>(this->storage) = new Fn(std::forward<F>(f));
+					this->ops = &InlineFunction::HeapOps<Fn>;
+				}
+			}
+
+			InlineFunction(InlineFunction&& other) noexcept {
+				this->MoveFrom(other);
+			}
+
+			InlineFunction& operator=(InlineFunction&& other) noexcept {
+				if (this != &other) {
+					this->Destroy();
+					this->MoveFrom(other);
+				}
+				return *this;
+			}
+
+			InlineFunction(const InlineFunction&) = delete;
+			InlineFunction& operator=(const InlineFunction&) = delete;
+
+			~InlineFunction() {
+				this->Destroy();
+			}
+
+			R operator()(Args... args) {
+				return this->ops->invoke(this->storage, std::forward<Args>(args)...);
+			}
+
+			explicit operator bool() const noexcept {
+				return this->ops != nullptr;
+			}
+
+		private:
+			struct Ops {
+				R (*invoke)(void* storage, Args&&... args);
+				void (*move)(void* dst, void* src) noexcept;
+				void (*destroy)(void* storage) noexcept;
+			};
+
+			template <class Fn>
+			static constexpr bool FitsInline() {
+				return sizeof(Fn) <= Capacity && alignof(Fn) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Fn>;
+			}
+
+			template <class Fn>
+			static constexpr Ops InlineOps = {
+				.invoke = [](void* storage, Args&&... args) -> R {
+					return (*static_cast<Fn*>(storage))(std::forward<Args>(args)...);
+				},
+				.move = [](void* dst, void* src) noexcept {
+					new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+					static_cast<Fn*>(src)->~Fn();
+				},
+				.destroy = [](void* storage) noexcept {
+					static_cast<Fn*>(storage)->~Fn();
+				},
+			};
+
+			template <class Fn>
+			static constexpr Ops HeapOps = {
+				.invoke = [](void* storage, Args&&... args) -> R {
+					return (**static_cast<Fn**>(storage))(std::forward<Args>(args)...);
+				},
+				.move = [](void* dst, void* src) noexcept {
+					*static_cast<Fn**>(dst) = *static_cast<Fn**>(src);
+				},
+				.destroy = [](void* storage) noexcept {
+					delete *static_cast<Fn**>(storage);
+				},
+			};
+
+			void MoveFrom(InlineFunction& other) noexcept {
+				this->ops = other.ops;
+				if (this->ops) {
+					this->ops->move(this->storage, other.storage);
+					other.ops = nullptr;
+				}
 			}
 
-			void SetUpdateOn(UpdateKind updateOn) {
-				this->updateOnKind = updateOn;
+			void Destroy() noexcept {
+				if (this->ops) {
+					this->ops->destroy(this->storage);
+					this->ops = nullptr;
+				}
 			}
 
-		protected:
-			UpdateKind updateOnKind = UpdateKind::Main;
+			alignas(std::max_align_t) std::byte storage[Capacity];
+			const Ops* ops = nullptr;
 	};
 
 	// A `Task` runs once in the next frame
@@ -36,12 +128,12 @@ namespace Gts {
 		double timeToLive;
 	};
 
-	class Oneshot : public BaseTask {
+	class Oneshot {
 		public:
-			Oneshot(std::function<void(const OneshotUpdate&)> tasking) : tasking(tasking), creationTime(Time::WorldTimeElapsed()) {
+			Oneshot(InlineFunction<void(const OneshotUpdate&)> tasking) : tasking(std::move(tasking)), creationTime(Time::WorldTimeElapsed()) {
 			}
 
-			virtual bool Update() override {
+			bool Update() {
 				double currentTime = Time::WorldTimeElapsed();
 				auto update = OneshotUpdate {
 					.timeToLive = currentTime - this->creationTime,
@@ -52,7 +144,7 @@ namespace Gts {
 
 		private:
 			double creationTime = 0.0;
-			std::function<void(const OneshotUpdate&)> tasking;
+			InlineFunction<void(const OneshotUpdate&)> tasking;
 	};
 
 	// A `Task` runs until it returns false
@@ -63,13 +155,13 @@ namespace Gts {
 		double delta;
 	};
 
-	class Task : public BaseTask {
+	class Task {
 		public:
-			Task(std::function<bool(const TaskUpdate&)> tasking) : tasking(tasking), lastRunTime(Time::WorldTimeElapsed()), startTime(Time::WorldTimeElapsed()) {
+			Task(InlineFunction<bool(const TaskUpdate&)> tasking) : tasking(std::move(tasking)), lastRunTime(Time::WorldTimeElapsed()), startTime(Time::WorldTimeElapsed()) {
 
 			}
 
-			virtual bool Update() override {
+			bool Update() {
 				TaskUpdate update;
 				double currentTime = Time::WorldTimeElapsed();
 				if (this->initRun) {
@@ -92,7 +184,7 @@ namespace Gts {
 			bool initRun = false;
 			double startTime = 0.0;
 			double lastRunTime = 0.0;
-			std::function<bool(const TaskUpdate&)> tasking;
+			InlineFunction<bool(const TaskUpdate&)> tasking;
 	};
 
 	struct TaskForUpdate {
@@ -106,12 +198,12 @@ namespace Gts {
 		double progressDelta;
 	};
 	// A `TaskFor` runs until it returns false OR the duration has elapsed
-	class TaskFor : public BaseTask {
+	class TaskFor {
 		public:
-			TaskFor(double duration, std::function<bool(const TaskForUpdate&)> tasking) : tasking(tasking), duration(duration), lastRunTime(Time::WorldTimeElapsed()), startTime(Time::WorldTimeElapsed()) {
+			TaskFor(double duration, InlineFunction<bool(const TaskForUpdate&)> tasking) : tasking(std::move(tasking)), duration(duration), lastRunTime(Time::WorldTimeElapsed()), startTime(Time::WorldTimeElapsed()) {
 			}
 
-			virtual bool Update() override {
+			bool Update() {
 				double currentTime = Time::WorldTimeElapsed();
 				double currentRuntime = currentTime - this->startTime;
 				double currentProgress = std::clamp(currentRuntime / this->duration, 0.0, 1.0);
@@ -146,10 +238,14 @@ namespace Gts {
 			double startTime = 0.0;
 			double lastRunTime = 0.0;
 			double lastProgress = 0.0;
-			std::function<bool(const TaskForUpdate&)> tasking;
+			InlineFunction<bool(const TaskForUpdate&)> tasking;
 			double duration;
 	};
 
+	// Slot index in the low 32 bits, slot generation in the high 32 bits
+	//  A stale id (task finished and slot reused) never matches a new task
+	using TaskId = std::uint64_t;
+	inline constexpr TaskId INVALID_TASK = std::numeric_limits<TaskId>::max();
 
 	class TaskManager : public EventListener {
 		public:
@@ -163,156 +259,261 @@ namespace Gts {
 			}
 
 			virtual void Update() override {
-				std::vector<std::string> toRemove = {};
-				for (auto& [name, task]: this->taskings) {
-					if (task->UpdateOn() == UpdateKind::Main) {
-						if (!task->Update()) {
-							toRemove.push_back(name);
-						}
-					}
-				}
-				for (auto task: toRemove) {
-					this->taskings.erase(task);
-				}
-
+				this->RunQueue(UpdateKind::Main);
 			}
 
 			// Update in camera update locations too....
 			virtual void CameraUpdate() override {
-				std::vector<std::string> toRemove = {};
-				for (auto& [name, task]: this->taskings) {
-					if (task->UpdateOn() == UpdateKind::Camera) {
-						if (!task->Update()) {
-							toRemove.push_back(name);
-						}
-					}
-				}
-
-				for (auto task: toRemove) {
-					this->taskings.erase(task);
-				}
-
+				this->RunQueue(UpdateKind::Camera);
 			}
 
 			virtual void HavokUpdate() override {
-				std::vector<std::string> toRemove = {};
-				for (auto& [name, task]: this->taskings) {
-					if (task->UpdateOn() == UpdateKind::Havok) {
-						if (!task->Update()) {
-							toRemove.push_back(name);
-						}
-					}
-				}
-
-				for (auto task: toRemove) {
-					this->taskings.erase(task);
-				}
+				this->RunQueue(UpdateKind::Havok);
 			}
 
 			virtual void BoneUpdate() override {
-				std::vector<std::string> toRemove = {};
-				for (auto& [name, task]: this->taskings) {
-					if (task->UpdateOn() == UpdateKind::Bone) {
-						if (!task->Update()) {
-							toRemove.push_back(name);
-						}
-					}
-				}
-
-				for (auto task: toRemove) {
-					this->taskings.erase(task);
-				}
+				this->RunQueue(UpdateKind::Bone);
 			}
 
 			virtual void PapyrusUpdate() override {
-				std::vector<std::string> toRemove = {};
-				for (auto& [name, task]: this->taskings) {
-					if (task->UpdateOn() == UpdateKind::Papyrus) {
-						if (!task->Update()) {
-							toRemove.push_back(name);
-						}
-					}
-				}
-
-				for (auto task: toRemove) {
-					this->taskings.erase(task);
-				}
+				this->RunQueue(UpdateKind::Papyrus);
 			}
 
 			static void ChangeUpdate(std::string_view name, UpdateKind updateOn) {
 				auto& me = TaskManager::GetSingleton();
-				try {
-					me.taskings.at(std::string(name))->SetUpdateOn(updateOn);
-				} catch (const std::out_of_range& oor) {
-					// nothing
+				TaskManager::ChangeUpdate(me.Find(name), updateOn);
+			}
+
+			static void ChangeUpdate(TaskId id, UpdateKind updateOn) {
+				auto& me = TaskManager::GetSingleton();
+				auto slot = me.Lookup(id);
+				if (!slot || slot->updateOn == updateOn) {
+					return;
+				}
+				slot->updateOn = updateOn;
+				// The old queue drops it on its next pass
+				std::uint8_t bit = TaskManager::QueueBit(updateOn);
+				if ((slot->queuedIn & bit) == 0) {
+					slot->queuedIn |= bit;
+					me.queues[static_cast<std::size_t>(updateOn)].push_back(TaskManager::SlotIndex(id));
 				}
 			}
 
 			static void Cancel(std::string_view name) {
 				auto& me = TaskManager::GetSingleton();
-				me.taskings.erase(std::string(name));
+				TaskManager::Cancel(me.Find(name));
 			}
 
-			static void Run(std::function<bool(const TaskUpdate&)> tasking) {
+			// Safe to call from inside a running task (including on itself)
+			static void Cancel(TaskId id) {
 				auto& me = TaskManager::GetSingleton();
-				auto task = new Task(tasking);
-				std::string name = std::format("UNNAMED_{}", *reinterpret_cast<std::uintptr_t*>(task));
-				me.taskings.try_emplace(
-					name,
-					task
-					);
+				if (me.Lookup(id)) {
+					me.Finish(TaskManager::SlotIndex(id));
+				}
 			}
 
-			static void Run(std::string_view name, std::function<bool(const TaskUpdate&)> tasking) {
-				auto& me = TaskManager::GetSingleton();
-				me.taskings.try_emplace(
-					std::string(name),
-					new Task(tasking)
-					);
+			static bool IsRunning(std::string_view name) {
+				return TaskManager::IsRunning(TaskManager::GetSingleton().Find(name));
 			}
 
-			static void RunFor(float duration, std::function<bool(const TaskForUpdate&)> tasking) {
-				auto& me = TaskManager::GetSingleton();
-				auto task = new TaskFor(duration, tasking);
-				std::string name = std::format("UNNAMED_{}", *reinterpret_cast<std::uintptr_t*>(task));
-				me.taskings.try_emplace(
-					name,
-					task
-					);
+			static bool IsRunning(TaskId id) {
+				return TaskManager::GetSingleton().Lookup(id) != nullptr;
 			}
 
-			static void RunFor(std::string_view name, float duration, std::function<bool(const TaskForUpdate&)> tasking) {
-				auto& me = TaskManager::GetSingleton();
-				me.taskings.try_emplace(
-					std::string(name),
-					new TaskFor(duration, tasking)
-					);
+			static TaskId Run(InlineFunction<bool(const TaskUpdate&)> tasking) {
+				return TaskManager::GetSingleton().Add<Task>("", std::move(tasking));
 			}
 
-			static void RunOnce(std::function<void(const OneshotUpdate&)> tasking) {
-				auto& me = TaskManager::GetSingleton();
-				auto task = new Oneshot(tasking);
-				std::string name = std::format("UNNAMED_{}", *reinterpret_cast<std::uintptr_t*>(task));
-				me.taskings.try_emplace(
-					name,
-					task
-					);
+			// A named task is not started if one with the same name is still running
+			static TaskId Run(std::string_view name, InlineFunction<bool(const TaskUpdate&)> tasking) {
+				return TaskManager::GetSingleton().Add<Task>(name, std::move(tasking));
 			}
 
-			static void RunOnce(std::string_view name, std::function<void(const OneshotUpdate&)> tasking) {
-				auto& me = TaskManager::GetSingleton();
-				me.taskings.try_emplace(
-					std::string(name),
-					new Oneshot(tasking)
-					);
+			static TaskId RunFor(float duration, InlineFunction<bool(const TaskForUpdate&)> tasking) {
+				return TaskManager::GetSingleton().Add<TaskFor>("", duration, std::move(tasking));
+			}
+
+			static TaskId RunFor(std::string_view name, float duration, InlineFunction<bool(const TaskForUpdate&)> tasking) {
+				return TaskManager::GetSingleton().Add<TaskFor>(name, duration, std::move(tasking));
+			}
+
+			static TaskId RunOnce(InlineFunction<void(const OneshotUpdate&)> tasking) {
+				return TaskManager::GetSingleton().Add<Oneshot>("", std::move(tasking));
+			}
+
+			static TaskId RunOnce(std::string_view name, InlineFunction<void(const OneshotUpdate&)> tasking) {
+				return TaskManager::GetSingleton().Add<Oneshot>(name, std::move(tasking));
 			}
 
 			static void CancelAllTasks() {
 				auto& me = TaskManager::GetSingleton();
-				me.taskings.clear();
+				if (me.passDepth > 0) {
+					// Running queues free them as they reach them
+					for (std::uint32_t index = 0; index < me.slots.size(); index++) {
+						if (me.slots[index].alive) {
+							me.Finish(index);
+						}
+					}
+				} else {
+					for (auto& queue: me.queues) {
+						queue.clear();
+					}
+					for (std::uint32_t index = 0; index < me.slots.size(); index++) {
+						auto& slot = me.slots[index];
+						slot.queuedIn = 0;
+						if (!std::holds_alternative<std::monostate>(slot.task)) {
+							slot.alive = false;
+							me.Free(index);
+						}
+					}
+					me.names.clear();
+				}
 				log::info("Canceled all task manager tasks");
 			}
 
-			std::unordered_map<std::string, BaseTask*> taskings;
+		private:
+			struct TaskSlot {
+				std::variant<std::monostate, Oneshot, Task, TaskFor> task;
+				std::string name;
+				std::uint32_t generation = 0;
+				UpdateKind updateOn = UpdateKind::Main;
+				// One bit per UpdateKind queue that still holds this slot
+				std::uint8_t queuedIn = 0;
+				bool alive = false;
+			};
+
+			struct NameHash {
+				using is_transparent = void;
+				std::size_t operator()(std::string_view value) const noexcept {
+					return std::hash<std::string_view>{}(value);
+				}
+			};
+
+			static std::uint8_t QueueBit(UpdateKind kind) {
+				return static_cast<std::uint8_t>(1u << static_cast<std::uint32_t>(kind));
+			}
+
+			static std::uint32_t SlotIndex(TaskId id) {
+				return static_cast<std::uint32_t>(id & 0xFFFFFFFFull);
+			}
+
+			static TaskId MakeId(std::uint32_t index, std::uint32_t generation) {
+				return (static_cast<TaskId>(generation) << 32) | index;
+			}
+
+			TaskId Find(std::string_view name) const {
+				auto found = this->names.find(name);
+				return found == this->names.end() ? INVALID_TASK : found->second;
+			}
+
+			TaskSlot* Lookup(TaskId id) {
+				std::uint32_t index = TaskManager::SlotIndex(id);
+				if (id == INVALID_TASK || index >= this->slots.size()) {
+					return nullptr;
+				}
+				auto& slot = this->slots[index];
+				if (!slot.alive || slot.generation != static_cast<std::uint32_t>(id >> 32)) {
+					return nullptr;
+				}
+				return &slot;
+			}
+
+			template <class T, class... Params>
+			TaskId Add(std::string_view name, Params&&... params) {
+				if (!name.empty()) {
+					TaskId existing = this->Find(name);
+					if (existing != INVALID_TASK) {
+						return existing;
+					}
+				}
+
+				std::uint32_t index;
+				if (!this->freeSlots.empty()) {
+					index = this->freeSlots.back();
+					this->freeSlots.pop_back();
+				} else {
+					index = static_cast<std::uint32_t>(this->slots.size());
+					// deque, so references held by a running task stay valid
+					this->slots.emplace_back();
+				}
+
+				auto& slot = this->slots[index];
+				slot.task.template emplace<T>(std::forward<Params>(params)...);
+				slot.name = name;
+				slot.updateOn = UpdateKind::Main;
+				slot.queuedIn = TaskManager::QueueBit(UpdateKind::Main);
+				slot.alive = true;
+				this->queues[static_cast<std::size_t>(UpdateKind::Main)].push_back(index);
+
+				TaskId id = TaskManager::MakeId(index, slot.generation);
+				if (!name.empty()) {
+					this->names.try_emplace(std::string(name), id);
+				}
+				return id;
+			}
+
+			// Stops the task, its storage is released once no queue references it
+			void Finish(std::uint32_t index) {
+				auto& slot = this->slots[index];
+				slot.alive = false;
+				if (!slot.name.empty()) {
+					auto found = this->names.find(std::string_view(slot.name));
+					if (found != this->names.end() && found->second == TaskManager::MakeId(index, slot.generation)) {
+						this->names.erase(found);
+					}
+				}
+			}
+
+			void Free(std::uint32_t index) {
+				auto& slot = this->slots[index];
+				// Releases everything the callable captured
+				slot.task = std::monostate {};
+				slot.name.clear();
+				slot.generation += 1;
+				this->freeSlots.push_back(index);
+			}
+
+			void RunQueue(UpdateKind kind) {
+				auto& queue = this->queues[static_cast<std::size_t>(kind)];
+				std::uint8_t bit = TaskManager::QueueBit(kind);
+				// Tasks queued while running start on the next pass
+				std::size_t count = queue.size();
+				std::size_t kept = 0;
+				this->passDepth += 1;
+				for (std::size_t i = 0; i < count; i++) {
+					std::uint32_t index = queue[i];
+					auto& slot = this->slots[index];
+					if (slot.alive && slot.updateOn == kind) {
+						bool keepRunning = std::visit([](auto& task) {
+							if constexpr (std::is_same_v<std::decay_t<decltype(task)>, std::monostate>) {
+								return false;
+							} else {
+								return task.Update();
+							}
+						}, slot.task);
+						if (!keepRunning && slot.alive) {
+							this->Finish(index);
+						}
+					}
+
+					if (slot.alive && slot.updateOn == kind) {
+						queue[kept] = index;
+						kept += 1;
+					} else {
+						slot.queuedIn &= ~bit;
+						if (!slot.alive && slot.queuedIn == 0) {
+							this->Free(index);
+						}
+					}
+				}
+				queue.erase(queue.begin() + kept, queue.begin() + count);
+				this->passDepth -= 1;
+			}
+
+			std::deque<TaskSlot> slots;
+			std::vector<std::uint32_t> freeSlots;
+			std::array<std::vector<std::uint32_t>, 5> queues;
+			std::unordered_map<std::string, TaskId, NameHash, std::equal_to<>> names;
+			std::uint32_t passDepth = 0;
 	};
 }
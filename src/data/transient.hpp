@@ -2,50 +2,54 @@
 // Module that holds data that is not persistent across saves
 #include "events.hpp"
 #include "spring.hpp"
+#include "data/slotmap.hpp"
 
 using namespace std;
 using namespace SKSE;
 using namespace RE;
 
 namespace Gts {
+	struct ActorRecord;
+
 	struct TempActorData {
+		// Read for every actor every frame (scale, speed and damage getters), keep them together
+		float otherScales;
 		float base_height;
 		float base_volume;
+		float MovementSlowdown;
+		float Hug_AnimSpeed;
+		float Perk_BonusActionSpeed;
+		float SizeVulnerability;
+		float ShrinkResistance;
+		float carryweight_boost;
+		float health_boost;
+		float push_force;
+		NiPoint3 BoundingBox_Cache;
+
 		float char_weight;
 		float shoe_weight;
 		float fall_start;
 		float last_set_fall_start;
-		float health_boost;
 		float SMT_Bonus_Duration;
 		float SMT_Penalty_Duration;
-		float carryweight_boost;
 		float FallTimer;
-		float Hug_AnimSpeed;
 		float Throw_Speed;
 		float potion_max_size;
 		float buttcrush_max_size;
 		float buttcrush_start_scale;
-		float SizeVulnerability;
-		float push_force;
-		float otherScales;
 		float vore_recorded_scale;
 		float WorldFov_Default;
 		float FpFov_Default;
 		float ButtCrushGrowthAmount;
-		float MovementSlowdown;
-		float ShrinkResistance;
 		float MightValue;
 
 		float Shrink_Ticks;
 		float Shrink_Ticks_Calamity;
 
-		float Perk_BonusActionSpeed;
 		float Perk_lifeForceStolen;
 		int   Perk_lifeForceStacks;
 
 		int CrushedTinies;
-
-		NiPoint3 BoundingBox_Cache;
 		
 		bool Throw_WasThrown;
 		bool can_do_vore;
@@ -102,6 +106,9 @@ namespace Gts {
 			[[nodiscard]] static Transient& GetSingleton() noexcept;
 
 			TempActorData* GetData(TESObjectREFR* object);
+			// Uses the handle cached on the record, falls back to a lookup by FormID
+			TempActorData* GetData(const ActorRecord& record);
+			SlotHandle GetHandle(TESObjectREFR* object) const;
 			TempActorData* GetActorData(Actor* actor);
 			std::vector<FormID> GetForms();
 
@@ -112,6 +119,7 @@ namespace Gts {
 		private:
 
 			mutable std::mutex _lock;
-			std::unordered_map<FormID, TempActorData> _actor_data;
+			// Only taken to add/remove actors, lookups are lock free
+			FormSlotMap<TempActorData> _actor_data;
 	};
 }
@@ -7,6 +7,34 @@ using namespace std;
 using namespace RE;
 using namespace SKSE;
 
+namespace {
+	// Indexed by ListenerHook, used for the profiler zone names
+	const std::array<std::string_view, static_cast<std::size_t>(Gts::ListenerHook::Total)> HOOK_NAMES = {
+		"Update",
+		"BoneUpdate",
+		"PapyrusUpdate",
+		"HavokUpdate",
+		"CameraUpdate",
+		"Reset",
+		"Enabled",
+		"Disabled",
+		"Start",
+		"DataReady",
+		"ResetActor",
+		"ActorEquip",
+		"DragonSoulAbsorption",
+		"ActorLoaded",
+		"HitEvent",
+		"UnderFootEvent",
+		"OnImpact",
+		"OnHighheelEquip",
+		"OnAddPerk",
+		"OnRemovePerk",
+		"MenuChange",
+		"ActorAnimEvent",
+	};
+}
+
 namespace Gts {
 	// Called on Live (non paused) gameplay
 	void EventListener::Update() {
@@ -110,151 +138,183 @@ namespace Gts {
 
 	}
 
-	void EventDispatcher::AddListener(EventListener* listener) {
-		if (listener) {
-			EventDispatcher::GetSingleton().listeners.push_back(listener);
+	void EventDispatcher::AddListener(EventListener* listener, const ListenerHooks& hooks) {
+		if (!listener) {
+			return;
+		}
+		auto& me = EventDispatcher::GetSingleton();
+		std::string name = listener->DebugName();
+		for (std::size_t hook = 0; hook < hooks.size(); hook++) {
+			if (hooks.test(hook)) {
+				auto& zone = me.zones.emplace_back(std::format("{}: {}", name, HOOK_NAMES[hook]));
+				me.subscribers[hook].push_back(Subscriber {
+					.listener = listener,
+					.zone = &zone,
+				});
+			}
 		}
 	}
 
 	void EventDispatcher::DoUpdate() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::Update)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->Update();
 		}
 	}
 
 	void EventDispatcher::DoBoneUpdate() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::BoneUpdate)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->BoneUpdate();
-			log::info("BoneUpdateRunning");
 		}
 	}
 
 	void EventDispatcher::DoPapyrusUpdate() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::PapyrusUpdate)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->PapyrusUpdate();
 		}
 	}
+
 	void EventDispatcher::DoHavokUpdate() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::HavokUpdate)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->HavokUpdate();
 		}
 	}
+
 	void EventDispatcher::DoCameraUpdate() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::CameraUpdate)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->CameraUpdate();
 		}
 	}
+
 	void EventDispatcher::DoReset() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::Reset)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->Reset();
 		}
 	}
+
 	void EventDispatcher::DoEnabled() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::Enabled)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->Enabled();
 		}
 	}
+
 	void EventDispatcher::DoDisabled() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::Disabled)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->Disabled();
 		}
 	}
+
 	void EventDispatcher::DoStart() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::Start)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->Start();
 		}
 	}
+
 	void EventDispatcher::DoDataReady() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::DataReady)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->DataReady();
 		}
 	}
+
 	void EventDispatcher::DoResetActor(Actor* actor) {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::ResetActor)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->ResetActor(actor);
 		}
 	}
+
 	void EventDispatcher::DoActorEquip(Actor* actor) {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::ActorEquip)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->ActorEquip(actor);
 		}
 	}
 
 	void EventDispatcher::DoDragonSoulAbsorption() {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::DragonSoulAbsorption)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->DragonSoulAbsorption();
 		}
 	}
 
 	void EventDispatcher::DoActorLoaded(Actor* actor) {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::ActorLoaded)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->ActorLoaded(actor);
 		}
 	}
+
 	void EventDispatcher::DoHitEvent(const TESHitEvent* evt) {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::HitEvent)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->HitEvent(evt);
 		}
 	}
+
 	void EventDispatcher::DoUnderFootEvent(const UnderFoot& evt) {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::UnderFootEvent)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->UnderFootEvent(evt);
 		}
 	}
+
 	void EventDispatcher::DoOnImpact(const Impact& impact) {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::OnImpact)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->OnImpact(impact);
 		}
 	}
+
 	void EventDispatcher::DoHighheelEquip(const HighheelEquip& evt) {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::OnHighheelEquip)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->OnHighheelEquip(evt);
 		}
 	}
-	void EventDispatcher::DoAddPerk(const AddPerkEvent& evt)  {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+
+	void EventDispatcher::DoAddPerk(const AddPerkEvent& evt) {
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::OnAddPerk)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->OnAddPerk(evt);
 		}
 	}
-	void EventDispatcher::DoRemovePerk(const RemovePerkEvent& evt)  {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+
+	void EventDispatcher::DoRemovePerk(const RemovePerkEvent& evt) {
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::OnRemovePerk)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->OnRemovePerk(evt);
 		}
 	}
+
 	void EventDispatcher::DoMenuChange(const MenuOpenCloseEvent* menu_event) {
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::MenuChange)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->MenuChange(menu_event);
 		}
 	}
+
 	void EventDispatcher::DoActorAnimEvent(Actor* actor, const BSFixedString& a_tag, const BSFixedString& a_payload) {
-		std::string tag = a_tag.c_str();
-		std::string payload = a_payload.c_str();
-		for (auto listener: EventDispatcher::GetSingleton().listeners) {
-			auto profiler = Profilers::Profile(listener->DebugName());
+		std::string_view tag = a_tag.c_str();
+		std::string_view payload = a_payload.c_str();
+		for (auto& [listener, zone]: EventDispatcher::Subscribers(ListenerHook::ActorAnimEvent)) {
+			auto profiler = Profilers::Profile(*zone);
 			listener->ActorAnimEvent(actor, tag, payload);
 		}
 	}
+
+	const std::vector<EventDispatcher::Subscriber>& EventDispatcher::Subscribers(ListenerHook hook) {
+		return EventDispatcher::GetSingleton().subscribers[static_cast<std::size_t>(hook)];
+	}
+
 	EventDispatcher& EventDispatcher::GetSingleton() {
 		static EventDispatcher instance;
 		return instance;
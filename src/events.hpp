@@ -341,6 +341,34 @@ namespace Gts {
 			virtual void ActorAnimEvent(Actor* actor, const std::string_view& tag, const std::string_view& payload);
 	};
 
+	// Every hook of EventListener, used to index the dispatcher subscriptions
+	enum class ListenerHook : std::uint8_t {
+		Update,
+		BoneUpdate,
+		PapyrusUpdate,
+		HavokUpdate,
+		CameraUpdate,
+		Reset,
+		Enabled,
+		Disabled,
+		Start,
+		DataReady,
+		ResetActor,
+		ActorEquip,
+		DragonSoulAbsorption,
+		ActorLoaded,
+		HitEvent,
+		UnderFootEvent,
+		OnImpact,
+		OnHighheelEquip,
+		OnAddPerk,
+		OnRemovePerk,
+		MenuChange,
+		ActorAnimEvent,
+		Total,
+	};
+	using ListenerHooks = std::bitset<static_cast<std::size_t>(ListenerHook::Total)>;
+
 	class EventDispatcher {
 		public:
 			// EventDispatcher() = default;
@@ -348,7 +376,14 @@ namespace Gts {
 			// EventDispatcher(EventDispatcher const&) = delete;
 			// EventDispatcher& operator=(EventDispatcher const&) = delete;
 
-			static void AddListener(EventListener* listener);
+			// Subscribes the listener to the hooks its class declares
+			template <class T>
+			static void AddListener(T* listener) {
+				static_assert(std::is_base_of_v<EventListener, T>);
+				EventDispatcher::AddListener(listener, EventDispatcher::DeclaredHooks<T>());
+			}
+			static void AddListener(EventListener* listener, const ListenerHooks& hooks);
+
 			static void DoUpdate();
 			static void DoBoneUpdate();
 			static void DoPapyrusUpdate();
@@ -372,7 +407,52 @@ namespace Gts {
 			static void DoMenuChange(const MenuOpenCloseEvent* menu_event);
 			static void DoActorAnimEvent(Actor* actor, const BSFixedString& a_tag, const BSFixedString& a_payload);
 		private:
+			struct Subscriber {
+				EventListener* listener;
+				const ProfilerZone* zone;
+			};
+
+			// &T::Hook is a pointer to an EventListener member only when T inherits the empty default,
+			//  anything else (an override, a hidden or overloaded name) keeps the listener subscribed
+			template <class T>
+			static ListenerHooks DeclaredHooks() {
+				ListenerHooks hooks;
+				if constexpr (std::is_same_v<T, EventListener>) {
+					hooks.set();
+				} else {
+#define GTS_DECLARES_HOOK(hook) hooks.set(static_cast<std::size_t>(ListenerHook::hook), !requires { requires std::is_same_v<decltype(&T::hook), decltype(&EventListener::hook)>; })
+					GTS_DECLARES_HOOK(Update);
+					GTS_DECLARES_HOOK(BoneUpdate);
+					GTS_DECLARES_HOOK(PapyrusUpdate);
+					GTS_DECLARES_HOOK(HavokUpdate);
+					GTS_DECLARES_HOOK(CameraUpdate);
+					GTS_DECLARES_HOOK(Reset);
+					GTS_DECLARES_HOOK(Enabled);
+					GTS_DECLARES_HOOK(Disabled);
+					GTS_DECLARES_HOOK(Start);
+					GTS_DECLARES_HOOK(DataReady);
+					GTS_DECLARES_HOOK(ResetActor);
+					GTS_DECLARES_HOOK(ActorEquip);
+					GTS_DECLARES_HOOK(DragonSoulAbsorption);
+					GTS_DECLARES_HOOK(ActorLoaded);
+					GTS_DECLARES_HOOK(HitEvent);
+					GTS_DECLARES_HOOK(UnderFootEvent);
+					GTS_DECLARES_HOOK(OnImpact);
+					GTS_DECLARES_HOOK(OnHighheelEquip);
+					GTS_DECLARES_HOOK(OnAddPerk);
+					GTS_DECLARES_HOOK(OnRemovePerk);
+					GTS_DECLARES_HOOK(MenuChange);
+					GTS_DECLARES_HOOK(ActorAnimEvent);
+#undef GTS_DECLARES_HOOK
+				}
+				return hooks;
+			}
+
 			[[nodiscard]] static EventDispatcher& GetSingleton();
-			std::vector<EventListener*> listeners;
+			[[nodiscard]] static const std::vector<Subscriber>& Subscribers(ListenerHook hook);
+
+			std::array<std::vector<Subscriber>, static_cast<std::size_t>(ListenerHook::Total)> subscribers;
+			// One zone per (listener, hook), a deque so the subscribers can point into it
+			std::deque<ProfilerZone> zones;
 	};
 }
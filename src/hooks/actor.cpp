@@ -117,7 +117,8 @@ namespace Hooks
 	float Hook_Actor::GetActorValue(ActorValueOwner* a_owner, ActorValue a_akValue) { // Override Carry Weight
 		float value = _GetActorValue(a_owner, a_akValue);
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			// Only installed in the ActorValueOwner vtable of actors, the RTTI cast is not needed
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				if (a_akValue == ActorValue::kCarryWeight) {
 					value = AttributeManager::AlterGetAv(a_this, a_akValue, value);
@@ -134,7 +135,7 @@ namespace Hooks
 		float value = _GetBaseActorValue(a_owner, a_akValue);
 		float bonus = 0.0f;
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				if (a_akValue == ActorValue::kCarryWeight) {
 					bonus = AttributeManager::AlterGetBaseAv(a_this, a_akValue, value);
@@ -146,7 +147,7 @@ namespace Hooks
 
 	void Hook_Actor::SetBaseActorValue(ActorValueOwner* a_owner, ActorValue a_akValue, float value) {
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				if (a_akValue == ActorValue::kCarryWeight) {
 					value = AttributeManager::AlterSetBaseAv(a_this, a_akValue, value);
@@ -159,7 +160,7 @@ namespace Hooks
 	float Hook_Actor::GetPermanentActorValue(ActorValueOwner* a_owner, ActorValue a_akValue) { // Override Carry Weight and Damage
 		float value = _GetPermanentActorValue(a_owner, a_akValue);
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				if (a_akValue == ActorValue::kCarryWeight) {
 					value = AttributeManager::AlterGetPermenantAv(a_this, a_akValue, value);
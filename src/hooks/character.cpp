@@ -91,7 +91,8 @@ namespace Hooks
 	float Hook_Character::GetActorValue(ActorValueOwner* a_owner, ActorValue a_akValue) { // Override Carry Weight and Damage
 		float value = _GetActorValue(a_owner, a_akValue);
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			// Only installed in the ActorValueOwner vtable of actors, the RTTI cast is not needed
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				if (a_akValue == ActorValue::kCarryWeight) {
 					value = AttributeManager::AlterGetAv(a_this, a_akValue, value);
@@ -107,7 +108,7 @@ namespace Hooks
 	float Hook_Character::GetBaseActorValue(ActorValueOwner* a_owner, ActorValue a_akValue) { // Override Health
 		float value = _GetBaseActorValue(a_owner, a_akValue);
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			float bonus = 1.0f;
 			if (a_this) {
 				if (a_akValue == ActorValue::kCarryWeight) {
@@ -120,7 +121,7 @@ namespace Hooks
 
 	void Hook_Character::SetBaseActorValue(ActorValueOwner* a_owner, ActorValue a_akValue, float value) {
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				if (a_akValue == ActorValue::kCarryWeight) {
 					value = AttributeManager::AlterSetBaseAv(a_this, a_akValue, value);
@@ -133,7 +134,7 @@ namespace Hooks
 	float Hook_Character::GetPermanentActorValue(ActorValueOwner* a_owner, ActorValue a_akValue) { // Override Carry Weight and Damage
 		float value = _GetPermanentActorValue(a_owner, a_akValue);
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				if (a_akValue == ActorValue::kCarryWeight) {
 					value = AttributeManager::AlterGetPermenantAv(a_this, a_akValue, value);
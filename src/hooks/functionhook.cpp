@@ -9,7 +9,7 @@ namespace Hooks {
 
 	void FunctionHook<void>::Attach(void** target, void* hook) {
 		uintptr_t base = REL::Module::get().base();
-		log::debug("Attaching function hook to address 0x{:X} (offset from image base of 0x{:X} by 0x{:X}...",
+		GTS_LOG_DEBUG("Attaching function hook to address 0x{:X} (offset from image base of 0x{:X} by 0x{:X}...",
 		           reinterpret_cast<uintptr_t>(*target), base, reinterpret_cast<uintptr_t>(*target) - base);
 		for (std::size_t i = 0; i < 3; ++i) {
 			auto result = DetourTransactionBegin();
@@ -17,11 +17,11 @@ namespace Hooks {
 				log::error("Failed to start transaction for unknown reason (error code {}).", result);
 				throw std::runtime_error("");
 			}
-			log::trace("Initiated transaction for function hook...");
+			GTS_LOG_TRACE("Initiated transaction for function hook...");
 			result = DetourUpdateThread(GetCurrentThread());
 			switch (result) {
 				case NO_ERROR:
-					log::trace("Function hook transaction thread information written...");
+					GTS_LOG_TRACE("Function hook transaction thread information written...");
 					break;
 				case ERROR_NOT_ENOUGH_MEMORY:
 					DetourTransactionAbort();
@@ -38,7 +38,7 @@ namespace Hooks {
 			result = DetourAttach(target, hook);
 			switch (result) {
 				case NO_ERROR:
-					log::trace("Function hook attached successfully in transaction, committing transaction...");
+					GTS_LOG_TRACE("Function hook attached successfully in transaction, committing transaction...");
 					break;
 				case ERROR_INVALID_BLOCK:
 					DetourTransactionAbort();
@@ -61,7 +61,7 @@ namespace Hooks {
 			result = DetourTransactionCommit();
 			switch (result) {
 				case NO_ERROR:
-					log::debug("Function hook to address {} committed, function hook is now active.",
+					GTS_LOG_DEBUG("Function hook to address {} committed, function hook is now active.",
 					           reinterpret_cast<uintptr_t>(*target));
 					return;
 				case ERROR_INVALID_DATA:
@@ -83,7 +83,7 @@ namespace Hooks {
 
 	void FunctionHook<void>::Detach(void** target, void* hook) {
 		uintptr_t base = REL::Module::get().base();
-		log::debug("Detaching function hook from address 0x{:X} (offset from image base of 0x{:X} by 0x{:X}...",
+		GTS_LOG_DEBUG("Detaching function hook from address 0x{:X} (offset from image base of 0x{:X} by 0x{:X}...",
 		           reinterpret_cast<uintptr_t>(*target), base, reinterpret_cast<uintptr_t>(*target) - base);
 		for (std::size_t i = 0; i < MAX_RETRY; ++i) {
 			auto result = DetourTransactionBegin();
@@ -91,11 +91,11 @@ namespace Hooks {
 				log::error("Failed to start transaction for unknown reason (error code {}).", result);
 				throw std::runtime_error("");
 			}
-			log::trace("Initiated transaction for function hook...");
+			GTS_LOG_TRACE("Initiated transaction for function hook...");
 			result = DetourUpdateThread(GetCurrentThread());
 			switch (result) {
 				case NO_ERROR:
-					log::trace("Function hook transaction thread information written...");
+					GTS_LOG_TRACE("Function hook transaction thread information written...");
 					break;
 				case ERROR_NOT_ENOUGH_MEMORY:
 					DetourTransactionAbort();
@@ -115,11 +115,11 @@ namespace Hooks {
 				log::error("Failed to detach function hook for unknown reason (error code {}).", result);
 				throw std::runtime_error("");
 			}
-			log::trace("Function hook detached successfully in transaction, committing transaction...");
+			GTS_LOG_TRACE("Function hook detached successfully in transaction, committing transaction...");
 			result = DetourTransactionCommit();
 			switch (result) {
 				case NO_ERROR:
-					log::debug("Function hook detachment for address {} committed, function hook has been removed.",
+					GTS_LOG_DEBUG("Function hook detachment for address {} committed, function hook has been removed.",
 					           reinterpret_cast<uintptr_t>(*target));
 					return;
 				case ERROR_INVALID_DATA:
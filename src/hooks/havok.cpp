@@ -1,4 +1,5 @@
 #include "managers/OverkillManager.hpp"
+#include "utils/CollisionRecords.hpp"
 #include "utils/actorUtils.hpp"
 #include "data/transient.hpp"
 #include "ActionSettings.hpp"
@@ -15,7 +16,6 @@ using namespace Gts;
 
 namespace {
 	const float tree_ignore_threshold = 16.0f;
-	const float actor_ignore_limit = 3.0f;
 
 	COL_LAYER GetCollisionLayer(const std::uint32_t& collisionFilterInfo) {
 		return static_cast<COL_LAYER>(collisionFilterInfo & 0x7F);
@@ -70,59 +70,6 @@ namespace {
 		return GetTESObjectREFR(&collidable);
 	}
 
-	bool IsCollisionDisabledBetween(TESObjectREFR* actor, TESObjectREFR* otherActor) {
-		if (!actor) {
-			return false;
-		}
-		if (!otherActor) {
-			return false;
-		}
-		auto tranDataA = Transient::GetSingleton().GetData(actor);
-		if (tranDataA) {
-			if (tranDataA->disable_collision_with == otherActor) {
-				return true;
-			}
-		}
-
-		auto tranDataB = Transient::GetSingleton().GetData(otherActor);
-		if (tranDataB) {
-			if (tranDataB->disable_collision_with == actor) {
-				return true;
-			}
-		}
-
-		Actor* actor_a = skyrim_cast<Actor*>(actor);
-		Actor* actor_b = skyrim_cast<Actor*>(otherActor);
-
-		if (actor_a && actor_b) {
-
-			float gts_scale = get_visual_scale(actor_a);
-			float tiny_scale = get_visual_scale(actor_b);
-
-			float Scale_A = get_visual_scale(actor_a) * GetSizeFromBoundingBox(actor_a); // A is usually GTS, but can be TIny as well
-			float Scale_B = get_visual_scale(actor_b) * GetSizeFromBoundingBox(actor_b); // B is usually a tiny but can be GTS as well
-
-			float sizedifference_gts = Scale_A/Scale_B;
-
-			if (gts_scale/tiny_scale < 1.0f) { // Switch actor roles
-				//log::info("Roles switched");
-				sizedifference_gts = Scale_B/Scale_A; // Rough fix for Tiny being the Gts sometimes
-			}
-
-			bool ignore = (sizedifference_gts >= actor_ignore_limit);
-			bool busy = IsGtsBusy(actor_a) && IsGtsBusy(actor_b);
-			bool grabbed = IsBeingHeld(actor_a, actor_b) || IsBeingHeld(actor_b, actor_a);
-			if (ignore) {
-				return true;
-			}
-			if (busy || grabbed) {
-				return true;
-			}
-		}
-
-		return false;
-	}
-
 	bool IsTreeCollisionDisabled(const hkpCollidable* a_collidableA, const hkpCollidable* a_collidableB) {
 
 		auto colLayerA = GetCollisionLayer(a_collidableA);
@@ -135,11 +82,11 @@ namespace {
 			auto obj_B = GetTESObjectREFR(a_collidableB);
 			
 			if (obj_A && obj_B) {
-				Actor* actor = skyrim_cast<Actor*>(obj_A);
-				if (actor) {
+				// 0 if A isn't a loaded actor
+				float actor_scale = CollisionRecords::GetVisualScale(obj_A);
+				if (actor_scale > 0.0f) {
 					//log::info("A is actor");
 					float tree_scale = static_cast<float>(obj_A->GetReferenceRuntimeData().refScale) / 100.0F;
-					float actor_scale = get_visual_scale(actor);
 					if (actor_scale/tree_scale >= tree_ignore_threshold) {
 						//log::info("A: {}", obj_A->GetDisplayFullName());
 						//log::info("B: {}", obj_B->GetDisplayFullName());
@@ -285,7 +232,7 @@ namespace Hooks
 					if (objB) {
 						if (objA != objB) {
 							//Throw_ThrowCheck(objA, objB, colLayerA, colLayerB);
-							if (IsCollisionDisabledBetween(objA, objB)) {
+							if (CollisionRecords::IsCollisionDisabled(objA, objB)) {
 								*a_result = false;
 							}
 						}
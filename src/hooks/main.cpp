@@ -85,6 +85,7 @@ namespace Hooks
 		Plugin::SetOnMainThread(false);
 
 		if (Config::GetSingleton().GetDebug().ShouldProfile()) {
+			Profilers::EndFrame();
 			static Timer timer = Timer(5.0);
 			if (timer.ShouldRun()) {
 				Profilers::Report();
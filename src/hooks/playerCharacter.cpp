@@ -71,7 +71,8 @@ namespace Hooks
 	float Hook_PlayerCharacter::GetActorValue(ActorValueOwner* a_owner, ActorValue a_akValue) { // Override Carry Weight and Sneak
 		float value = _GetActorValue(a_owner, a_akValue);
 		if (Plugin::Ready()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			// Only installed in the ActorValueOwner vtable of actors, the RTTI cast is not needed
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				value = AttributeManager::AlterGetAv(a_this, a_akValue, value);
 			}
@@ -82,7 +83,7 @@ namespace Hooks
 	float Hook_PlayerCharacter::GetBaseActorValue(ActorValueOwner* a_owner, ActorValue a_akValue) { // Override Health
 		float value = _GetBaseActorValue(a_owner, a_akValue);
 		if (Plugin::Ready()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			float bonus = 1.0f;
 			if (a_this) {
 				value = AttributeManager::AlterGetBaseAv(a_this, a_akValue, value);
@@ -93,7 +94,7 @@ namespace Hooks
 
 	void Hook_PlayerCharacter::SetBaseActorValue(ActorValueOwner* a_owner, ActorValue a_akValue, float value) {
 		if (Plugin::InGame()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				value = AttributeManager::AlterSetBaseAv(a_this, a_akValue, value);
 			}
@@ -104,7 +105,7 @@ namespace Hooks
 	float Hook_PlayerCharacter::GetPermanentActorValue(ActorValueOwner* a_owner, ActorValue a_akValue) { // Override Carry Weight and Damage
 		float value = _GetPermanentActorValue(a_owner, a_akValue);
 		if (Plugin::Ready()) {
-			Actor* a_this = skyrim_cast<Actor*>(a_owner);
+			Actor* a_this = static_cast<Actor*>(a_owner);
 			if (a_this) {
 				value = AttributeManager::AlterGetPermenantAv(a_this, a_akValue, value);
 			}
@@ -4,9 +4,12 @@
 #include "managers/GtsManager.hpp"
 #include "managers/Attributes.hpp"
 #include "managers/highheel.hpp"
+#include "utils/ActorRegistry.hpp"
 #include "utils/actorUtils.hpp"
 #include "data/persistent.hpp"
 #include "data/runtime.hpp"
+#include "data/plugin.hpp"
+#include "data/time.hpp"
 #include "scale/scale.hpp"
 #include "profiler.hpp"
 #include "timer.hpp"
@@ -115,6 +118,30 @@ namespace Gts {
 	void AttributeManager::Update() {
 		static Timer timer = Timer(0.5);
 
+		// The hooks ask for these many times per actor per frame, they are computed once here
+		{
+			auto profiler = Profilers::Profile("Attributes: Snapshot");
+			auto snapshot = std::make_shared<AttributeSnapshot>();
+			snapshot->frame = Time::FramesElapsed();
+			auto actors = ActorRegistry::Actors(); // Already sorted by pointer
+			snapshot->actors.reserve(actors.size());
+			snapshot->bonuses.reserve(actors.size());
+			for (auto actor: actors) {
+				if (!actor) {
+					continue; // Reset during this frame
+				}
+				snapshot->actors.push_back(actor);
+				snapshot->bonuses.push_back(AttributeBonuses {
+					.health = this->GetAttributeBonus(actor, ActorValue::kHealth),
+					.carryWeight = this->GetAttributeBonus(actor, ActorValue::kCarryWeight),
+					.speedMult = this->GetAttributeBonus(actor, ActorValue::kSpeedMult),
+					.attackDamageMult = this->GetAttributeBonus(actor, ActorValue::kAttackDamageMult),
+					.jumpingBonus = this->GetAttributeBonus(actor, ActorValue::kJumpingBonus),
+				});
+			}
+			this->snapshot.store(std::move(snapshot), std::memory_order_release);
+		}
+
 		if (timer.ShouldRunFrame()) { // Run once per 0.5 sec
 			for (auto actor: find_actors()) {
 				if (actor) {
@@ -127,6 +154,10 @@ namespace Gts {
 	}
 
 
+	void AttributeManager::Reset() {
+		this->snapshot.store(nullptr, std::memory_order_release);
+	}
+
 	void AttributeManager::OverrideSMTBonus(float Value) {
 		auto ActorAttributes = Persistent::GetSingleton().GetData(PlayerCharacter::GetSingleton());
 		if (ActorAttributes) {
@@ -243,13 +274,38 @@ namespace Gts {
 		}
 	}
 
+	float AttributeManager::GetFrameAttributeBonus(Actor* actor, ActorValue av) {
+		auto snapshot = this->snapshot.load(std::memory_order_acquire);
+		// Listeners before us read the previous frame, and the frame count does not move while paused
+		bool current = snapshot && snapshot->frame == Time::FramesElapsed() && Plugin::Live();
+		if (current && actor) {
+			auto found = std::lower_bound(snapshot->actors.begin(), snapshot->actors.end(), actor);
+			if (found != snapshot->actors.end() && *found == actor) {
+				auto& bonuses = snapshot->bonuses[found - snapshot->actors.begin()];
+				switch (av) {
+					case ActorValue::kHealth:
+						return bonuses.health;
+					case ActorValue::kCarryWeight:
+						return bonuses.carryWeight;
+					case ActorValue::kSpeedMult:
+						return bonuses.speedMult;
+					case ActorValue::kAttackDamageMult:
+						return bonuses.attackDamageMult;
+					case ActorValue::kJumpingBonus:
+						return bonuses.jumpingBonus;
+				}
+			}
+		}
+		return this->GetAttributeBonus(actor, av);
+	}
+
 	float AttributeManager::AlterGetAv(Actor* actor, ActorValue av, float originalValue) {
 		float bonus = 1.0f;
 
 		auto& attributes = AttributeManager::GetSingleton();
 		switch (av) {
 			case ActorValue::kCarryWeight: {
-				bonus = attributes.GetAttributeBonus(actor, av);
+				bonus = attributes.GetFrameAttributeBonus(actor, av);
 				auto transient = Transient::GetSingleton().GetData(actor);
 				if (transient != nullptr) {
 					transient->carryweight_boost = (originalValue * bonus) - originalValue;
@@ -274,7 +330,7 @@ namespace Gts {
 				}
 
 				if (scale > 1.0f) {
-					bonus = attributes.GetAttributeBonus(actor, av);
+					bonus = attributes.GetFrameAttributeBonus(actor, av);
 				} else {
 					//Linearly decrease such that:
 					//at zero scale health=0.0
@@ -332,7 +388,7 @@ namespace Gts {
 		float bonus = 1.0f;
 		if (actor) {
 			auto& attributes = AttributeManager::GetSingleton();
-			bonus = attributes.GetAttributeBonus(actor, ActorValue::kSpeedMult);
+			bonus = attributes.GetFrameAttributeBonus(actor, ActorValue::kSpeedMult);
 		}
 		return bonus;
 	}
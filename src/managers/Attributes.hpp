@@ -8,15 +8,29 @@ using namespace RE;
 
 namespace Gts {
 
+	// Result of AttributeManager::GetAttributeBonus for each of the altered values
+	struct AttributeBonuses {
+		float health = 1.0f;
+		float carryWeight = 1.0f;
+		float speedMult = 1.0f;
+		float attackDamageMult = 1.0f;
+		float jumpingBonus = 1.0f;
+	};
+
 	class AttributeManager : public EventListener {
 		public:
 			[[nodiscard]] static AttributeManager& GetSingleton() noexcept;
 
 			virtual std::string DebugName() override;
 			virtual void Update() override;
+			virtual void Reset() override;
 
 			void OverrideSMTBonus(float Value);
 			float GetAttributeBonus(Actor* actor, ActorValue av);
+			// Same as GetAttributeBonus but read from the bonuses AttributeManager::Update computed this frame
+			//  Lock free and safe on any thread. Computed on the call for actors that were not loaded then,
+			//  before that update has run this frame and while the game is paused (e.g. a potion in the inventory)
+			float GetFrameAttributeBonus(Actor* actor, ActorValue av);
 
 			static float AlterGetAv(Actor* actor, ActorValue av, float originalValue);
 			static float AlterGetBaseAv(Actor* actor, ActorValue av, float originalValue);
@@ -25,6 +39,16 @@ namespace Gts {
 			static float AlterMovementSpeed(Actor* actor, const NiPoint3& direction);
 			static float AlterGetAvMod(float orginal_value, Actor* a_this, ACTOR_VALUE_MODIFIER a_modifier, ActorValue a_value);
 		private:
+			// Bonuses of every loaded actor, both sorted by actor pointer
+			struct AttributeSnapshot {
+				// Time::FramesElapsed() when it was taken
+				std::uint64_t frame = 0;
+				std::vector<Actor*> actors;
+				std::vector<AttributeBonuses> bonuses;
+			};
+
+			std::atomic<std::shared_ptr<const AttributeSnapshot>> snapshot;
+
 			const SoftPotential speed_adjustment_walk {
 				.k = 0.265f, // 0.125
 				.n = 1.11f, // 0.86
@@ -0,0 +1,124 @@
+#include "managers/FadeManager.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "utils/actorUtils.hpp"
+#include "scale/scale.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+
+using namespace SKSE;
+using namespace RE;
+using namespace Gts;
+using namespace std;
+
+namespace {
+	// No fix: 
+	// -Followers fade away at ~x1000 scale, may even fade earlier than that
+	// -Proteus Player gets disabled at ~x2200 scale
+
+	// With fix:
+	// -Followers render even at x26000 scale
+	// -Proteus Player is also rendered even at x26000 scale
+	// -At this point only draw distance limit of the game hides the characters at such gigantic scales
+
+	// Actors at or above this scale are always drawn
+	const float ALWAYS_DRAW_SCALE = 1.5f;
+	// ...and only go back to fading once they are below this, so scales around x1.5 don't flip every frame
+	const float FADE_SCALE = 1.45f;
+	// GTS_Busy is a behavior graph lookup, smaller actors only poll it this often (seconds)
+	const double BUSY_POLL_TIME = 0.25;
+}
+
+namespace Gts {
+	FadeManager& FadeManager::GetSingleton() noexcept {
+		static FadeManager instance;
+		return instance;
+	}
+
+	std::string FadeManager::DebugName() {
+		return "FadeManager";
+	}
+
+	void FadeManager::Update() {
+		auto profiler = Profilers::Profile("FadeManager: Update");
+		std::uint64_t frame = Time::FramesElapsed();
+
+		for (auto& record: ActorRegistry::Records()) {
+			Actor* actor = record.actor;
+			if (!actor || !record.is3DLoaded) {
+				continue;
+			}
+			auto& state = this->states[record.formID];
+			state.seenFrame = frame;
+
+			bool alwaysDraw = this->WantsAlwaysDraw(actor, record.isPlayer, state);
+			bool changed = alwaysDraw != state.alwaysDraw;
+			state.alwaysDraw = alwaysDraw;
+
+			for (std::size_t i = 0; i < state.models.size(); i++) {
+				NiAVObject* model = actor->Get3D(i == 1);
+				if (!model) {
+					state.models[i].reset();
+					continue;
+				}
+				if (changed || state.models[i].get() != model) {
+					FadeManager::ApplyFlags(model, alwaysDraw);
+					state.models[i] = NiPointer<NiAVObject>(model);
+				}
+			}
+		}
+
+		// Unloaded actors, also drops our references to their 3D
+		std::erase_if(this->states, [frame](const auto& item) {
+			return item.second.seenFrame != frame;
+		});
+	}
+
+	void FadeManager::Reset() {
+		this->states.clear();
+	}
+
+	void FadeManager::ResetActor(Actor* actor) {
+		if (actor) {
+			this->states.erase(actor->formID);
+		}
+	}
+
+	void FadeManager::ActorLoaded(Actor* actor) {
+		if (actor) {
+			this->states.erase(actor->formID);
+		}
+	}
+
+	bool FadeManager::WantsAlwaysDraw(Actor* actor, bool isPlayer, FadeState& state) {
+		if (isPlayer) {
+			return true;
+		}
+		float scale = get_visual_scale(actor);
+		if (scale >= ALWAYS_DRAW_SCALE) {
+			return true;
+		}
+
+		double now = Time::WorldTimeElapsed();
+		if (now - state.busyCheckTime >= BUSY_POLL_TIME) {
+			state.busy = IsGtsBusy(actor);
+			state.busyCheckTime = now;
+		}
+		if (state.busy) {
+			return true;
+		}
+		// Between the two thresholds the last state is kept
+		return scale >= FADE_SCALE && state.alwaysDraw;
+	}
+
+	void FadeManager::ApplyFlags(NiAVObject* model, bool alwaysDraw) {
+		if (alwaysDraw) {
+			model->GetFlags().set(RE::NiAVObject::Flag::kIgnoreFade);
+			model->GetFlags().set(RE::NiAVObject::Flag::kAlwaysDraw);
+			model->GetFlags().set(RE::NiAVObject::Flag::kHighDetail);
+		} else {
+			model->GetFlags().reset(RE::NiAVObject::Flag::kIgnoreFade);
+			model->GetFlags().reset(RE::NiAVObject::Flag::kAlwaysDraw);
+			model->GetFlags().reset(RE::NiAVObject::Flag::kHighDetail);
+		}
+	}
+}
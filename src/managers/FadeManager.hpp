@@ -0,0 +1,37 @@
+#pragma once
+// Module that keeps large actors from fading out at a distance
+//  Flags are only written to the 3D when the wanted state changes or a new 3D is loaded
+
+#include "events.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+	class FadeManager : public EventListener {
+		public:
+			[[nodiscard]] static FadeManager& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+			virtual void ActorLoaded(Actor* actor) override;
+
+		private:
+			struct FadeState {
+				// 3D the flags were last written to, third person then first person
+				std::array<NiPointer<NiAVObject>, 2> models;
+				bool alwaysDraw = false;
+				bool busy = false;
+				double busyCheckTime = -std::numeric_limits<double>::infinity();
+				std::uint64_t seenFrame = 0;
+			};
+
+			bool WantsAlwaysDraw(Actor* actor, bool isPlayer, FadeState& state);
+			static void ApplyFlags(NiAVObject* model, bool alwaysDraw);
+
+			std::unordered_map<FormID, FadeState> states;
+	};
+}
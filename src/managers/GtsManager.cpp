@@ -18,6 +18,8 @@
 #include "managers/hitmanager.hpp"
 #include "utils/MovementForce.hpp"
 #include "utils/DynamicScale.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "utils/UpdateScheduler.hpp"
 #include "managers/highheel.hpp"
 #include "utils/actorUtils.hpp"
 #include "utils/actorBools.hpp"
@@ -47,6 +49,9 @@ using namespace std;
 
 namespace {
 	const float ini_adjustment = 1000000; //1 million units distance
+	// Idle foot damage of actors updated every few frames catches up for at most this many frames,
+	// e.g. after PreciseDamageOthers was off for a while
+	const std::uint64_t MAX_IDLE_DAMAGE_FRAMES = 16;
 
 	void FixEmotionsRange() { // Makes facial emotions always enabled at any size
 		EnsureINIFloat("fTalkingDistance:LOD", ini_adjustment);
@@ -65,15 +70,17 @@ namespace {
 		}
 	}
 
-	void Foot_PerformIdle_Headtracking_Effects_Others(Actor* actor) {
+	void Foot_PerformIdle_Headtracking_Effects_Others(Actor* actor, std::uint64_t frames) {
 		if (actor && Runtime::GetBool("PreciseDamageOthers")) {
 			auto& CollisionDamage = CollisionDamage::GetSingleton();
 			if (actor->formID != 0x14 && !IsTeammate(actor)) {
+				// TimeScale() is one frame worth, the actor may not have been checked for a few frames
+				float damage = Damage_Default_Underfoot * TimeScale() * static_cast<float>(std::min(frames, MAX_IDLE_DAMAGE_FRAMES));
 				if (GetBusyFoot(actor) != BusyFoot::RightFoot) {
-					CollisionDamage.DoFootCollision(actor, Damage_Default_Underfoot * TimeScale(), Radius_Default_Idle, 0, 0.0f, Minimum_Actor_Crush_Scale_Idle, DamageSource::FootIdleR, true, false, false, false);
+					CollisionDamage.DoFootCollision(actor, damage, Radius_Default_Idle, 0, 0.0f, Minimum_Actor_Crush_Scale_Idle, DamageSource::FootIdleR, true, false, false, false);
 				}
 				if (GetBusyFoot(actor) != BusyFoot::LeftFoot) {
-					CollisionDamage.DoFootCollision(actor, Damage_Default_Underfoot * TimeScale(), Radius_Default_Idle, 0, 0.0f, Minimum_Actor_Crush_Scale_Idle, DamageSource::FootIdleL, false, false, false, false);
+					CollisionDamage.DoFootCollision(actor, damage, Radius_Default_Idle, 0, 0.0f, Minimum_Actor_Crush_Scale_Idle, DamageSource::FootIdleL, false, false, false, false);
 				}
 			}
 		}
@@ -111,44 +118,6 @@ namespace {
 		}
 	}
 
-	void FixActorFade() {
-		auto profiler = Profilers::Profile("Manager: Fade Fix");
-		// No fix: 
-		// -Followers fade away at ~x1000 scale, may even fade earlier than that
-		// -Proteus Player gets disabled at ~x2200 scale
-
-		// With fix:
-		// -Followers render even at x26000 scale
-		// -Proteus Player is also rendered even at x26000 scale
-		// -At this point only draw distance limit of the game hides the characters at such gigantic scales
-
-		static Timer ApplyTimer = Timer(1.00);
-		bool reset = false;
-
-		if (ApplyTimer.ShouldRunFrame()) {
-			for (auto actor: find_actors()) {
-				if (actor) {
-					for (auto fp : {true, false}) {
-						auto model = actor->Get3D(fp);
-						if (model) {
-							get_visual_scale(actor) < 1.5f ? reset = true : reset = false; 
-
-							if (!reset || IsGtsBusy(actor) || actor->formID == 0x14) {
-								model->GetFlags().set(RE::NiAVObject::Flag::kIgnoreFade);
-								model->GetFlags().set(RE::NiAVObject::Flag::kAlwaysDraw);
-								model->GetFlags().set(RE::NiAVObject::Flag::kHighDetail);
-							} else {
-								model->GetFlags().reset(RE::NiAVObject::Flag::kIgnoreFade);
-								model->GetFlags().reset(RE::NiAVObject::Flag::kAlwaysDraw);
-								model->GetFlags().reset(RE::NiAVObject::Flag::kHighDetail);
-							}
-						}
-					}
-				}
-			}
-		}
-	}
-
 	void PerformRoofRaycastAdjustments(Actor* actor, float& target_scale, float currentOtherScale) {
 		if (SizeRaycastEnabled() && !actor->IsDead() && target_scale > 1.025f) {
 			float room_scale = GetMaxRoomScale(actor);
@@ -163,7 +132,7 @@ namespace {
 		}
 	}
 
-	void update_height(Actor* actor, ActorData* persi_actor_data, TempActorData* trans_actor_data) {
+	void update_height(Actor* actor, ActorData* persi_actor_data, TempActorData* trans_actor_data, SpringBatch& springs) {
 		auto profiler = Profilers::Profile("Manager: update_height");
 		if (!actor) {
 			return;
@@ -190,12 +159,11 @@ namespace {
 				persi_actor_data->target_scale = target;
 				persi_actor_data->target_scale_v = 0.0f;
 			} else {
-				critically_damped(
+				springs.Add(
 					persi_actor_data->target_scale,
 					persi_actor_data->target_scale_v,
 					max_scale,
-					persi_actor_data->half_life*1.5f,
-					Time::WorldTimeDelta()
+					persi_actor_data->half_life*1.5f
 					);
 			}
 		} else {
@@ -213,12 +181,11 @@ namespace {
 				persi_actor_data->visual_scale = target_scale;
 				persi_actor_data->visual_scale_v = 0.0f;
 			} else {
-				critically_damped(
+				springs.Add(
 					persi_actor_data->visual_scale,
 					persi_actor_data->visual_scale_v,
 					target_scale,
-					persi_actor_data->half_life / TimeScale(),
-					Time::WorldTimeDelta()
+					persi_actor_data->half_life / TimeScale()
 				);
 			}
 		}
@@ -303,20 +270,31 @@ namespace {
 		persi_actor_data->anim_speed = GetAnimationSlowdown(actor); // else behave as usual
 	}
 
-	void update_actor(Actor* actor) {
+	void update_actor(const ActorRecord& record, SpringBatch& springs) {
 		auto profiler = Profilers::Profile("Manager: update_actor");
-		auto temp_data = Transient::GetSingleton().GetActorData(actor);
-		auto saved_data = Persistent::GetSingleton().GetActorData(actor);
-		update_height(actor, saved_data, temp_data);
+		// The handles on the record skip the FormID lookup, actors seen for the first time are added here
+		auto temp_data = Transient::GetSingleton().GetData(record);
+		if (!temp_data) {
+			temp_data = Transient::GetSingleton().GetActorData(record.actor);
+		}
+		auto saved_data = Persistent::GetSingleton().GetData(record);
+		if (!saved_data) {
+			saved_data = Persistent::GetSingleton().GetActorData(record.actor);
+		}
+		update_height(record.actor, saved_data, temp_data, springs);
 	}
 
-	void apply_actor(Actor* actor, bool force = false) {
+	void apply_actor(Actor* actor, ActorData* saved_data, TempActorData* temp_data, bool force = false) {
 		auto profiler = Profilers::Profile("Manager: apply_actor");
-		auto temp_data = Transient::GetSingleton().GetData(actor);
-		auto saved_data = Persistent::GetSingleton().GetData(actor);
 		apply_height(actor, saved_data, temp_data, force);
 		apply_speed(actor, saved_data, temp_data, force);
 	}
+
+	void apply_actor(Actor* actor, bool force = false) {
+		auto temp_data = Transient::GetSingleton().GetData(actor);
+		auto saved_data = Persistent::GetSingleton().GetData(actor);
+		apply_actor(actor, saved_data, temp_data, force);
+	}
 }
 
 GtsManager& GtsManager::GetSingleton() noexcept {
@@ -348,13 +326,21 @@ void GtsManager::Update() {
 	UpdateMaxScale(); // Update max scale of each actor in the scene
 	ManageActorControl(); // Sadly have to call it non stop since im unsure how to easily fix it otherwise :(
 	ShiftAudioFrequency();
-	FixActorFade();
 
-	for (auto actor: find_actors()) {
+	// Every actor's scale is stepped before any of them is applied or used for effects below
+	for (auto& record: ActorRegistry::Records()) {
+		if (record.actor) {
+			update_actor(record, this->heightSprings);
+		}
+	}
+	this->heightSprings.Solve(Time::WorldTimeDelta());
+
+	for (auto& record: ActorRegistry::Records()) {
+		Actor* actor = record.actor;
 		if (actor) {
 			auto& sizemanager = SizeManager::GetSingleton();
 
-			if (actor->formID == 0x14 || IsTeammate(actor)) {
+			if (record.isPlayer || record.isTeammate) {
 				ClothManager::GetSingleton().CheckClothingRip(actor);
 				GameModeManager::GetSingleton().GameMode(actor); // Handle Game Modes
 				Foot_PerformIdleEffects_Main(actor); // Just idle zones for pushing away/dealing minimal damage
@@ -367,11 +353,18 @@ void GtsManager::Update() {
 				}
 			}
 
-			Foot_PerformIdle_Headtracking_Effects_Others(actor); // Just idle zones for pushing away/dealing minimal damage, but this one is for others as well
-			update_actor(actor);
-			apply_actor(actor);
+			apply_actor(actor, Persistent::GetSingleton().GetData(record), Transient::GetSingleton().GetData(record));
 		}
 	}
+
+	if (Runtime::GetBool("PreciseDamageOthers")) {
+		// Just idle zones for pushing away/dealing minimal damage, but this one is for others as well
+		// Small actors far away are checked every few frames, their damage is scaled by the frames in between
+		static const UpdateTaskId idleTask = UpdateScheduler::Register(UpdateTask { .name = "Manager: Idle Others" });
+		UpdateScheduler::Run(idleTask, [](Actor* actor, std::uint64_t frames) {
+			Foot_PerformIdle_Headtracking_Effects_Others(actor, frames);
+		});
+	}
 }
 
 void GtsManager::DragonSoulAbsorption() {
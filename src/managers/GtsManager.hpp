@@ -8,6 +8,7 @@
 
 #include "events.hpp"
 #include "node.hpp"
+#include "spring.hpp"
 
 using namespace std;
 using namespace RE;
@@ -35,5 +36,9 @@ namespace Gts {
 			// Reapply changes (used after reload events)
 			void reapply(bool force = true);
 			void reapply_actor(Actor* actor, bool force = true);
+
+		private:
+			// Scale smoothing of every actor, solved together once per frame
+			SpringBatch heightSprings;
 	};
 }
@@ -62,6 +62,35 @@ namespace {
 		});
 		return results;
 	}
+
+	// Position of the button in InputKeys, INPUT_KEY_COUNT if it isn't tracked
+	std::size_t GetKeyIndex(ButtonEvent* button) {
+		std::uint32_t key = button->GetIDCode();
+		switch (button->device.get()) {
+			case INPUT_DEVICE::kKeyboard: {
+				return key < MOUSE_OFFSET ? key : INPUT_KEY_COUNT;
+			}
+			case INPUT_DEVICE::kMouse: {
+				return key < GAMEPAD_OFFSET - MOUSE_OFFSET ? key + MOUSE_OFFSET : INPUT_KEY_COUNT;
+			}
+			case INPUT_DEVICE::kGamepad: {
+				// Triggers are the only gamepad keys that aren't a single bit
+				if (key == BSWin32GamepadDevice::Key::kLeftTrigger) {
+					return GAMEPAD_OFFSET + 0x10;
+				}
+				if (key == BSWin32GamepadDevice::Key::kRightTrigger) {
+					return GAMEPAD_OFFSET + 0x11;
+				}
+				if (std::has_single_bit(key)) {
+					return GAMEPAD_OFFSET + std::countr_zero(key);
+				}
+				return INPUT_KEY_COUNT;
+			}
+			default: {
+				return INPUT_KEY_COUNT;
+			}
+		}
+	}
 }
 
 namespace Gts {
@@ -117,7 +146,7 @@ namespace Gts {
 
 		this->minDuration = duration;
 		this->startTime = 0.0;
-		this->keys = {};
+		this->keys.reset();
 		const auto keys = toml::find_or<vector<std::string> >(data, "keys", {});
 		for (const auto& key: keys) {
 			std::string upper_key = str_toupper(remove_whitespace(key));
@@ -131,11 +160,11 @@ namespace Gts {
 			}
 			try {
 				std::uint32_t key_code = NAMED_KEYS.at(upper_key);
-				this->keys.emplace(key_code);
+				this->keys.set(key_code);
 			} 
 			catch (std::out_of_range e) {
 				log::warn("Key named {}=>{} in {} was unrecongized.", key, upper_key, this->name);
-				this->keys.clear();
+				this->keys.reset();
 				return; // Remove all keys and return so that this becomes an INVALID key entry and won't fire
 			}
 		}
@@ -166,28 +195,18 @@ namespace Gts {
 		return false;
 	}
 
-	bool InputEventData::AllKeysPressed(const std::unordered_set<std::uint32_t>& keys) {
-		if (this->keys.empty()) {
+	bool InputEventData::AllKeysPressed(const InputKeys& keys) const {
+		if (this->keys.none()) {
 			return false;
 		}
-		for (const auto& key : this->keys) {
-			if (keys.find(key) == keys.end()) {
-				// Key not found
-				return false;
-			}
-		}
-		return true;
+		return (keys & this->keys) == this->keys;
 	}
 
-	bool InputEventData::OnlyKeysPressed(const std::unordered_set<std::uint32_t>& keys_in) {
-		std::unordered_set<std::uint32_t> keys(keys_in); // Copy
-		for (const auto& key : this->keys) {
-			keys.erase(key);
-		}
-		return keys.size() == 0;
+	bool InputEventData::OnlyKeysPressed(const InputKeys& keys) const {
+		return (keys & ~this->keys).none();
 	}
 
-	bool InputEventData::ShouldFire(const std::unordered_set<std::uint32_t>& a_gameInputKeys) {
+	bool InputEventData::ShouldFire(const InputKeys& a_gameInputKeys) {
 		bool shouldFire = false;
 		// Check based on keys and duration
 		if (this->AllKeysPressed(a_gameInputKeys) && (!this->exclusive || this->OnlyKeysPressed(a_gameInputKeys))) {
@@ -276,18 +295,18 @@ namespace Gts {
 	}
 
 	bool InputEventData::HasKeys() const {
-		return !this->keys.empty();
+		return this->keys.any();
 	}
 
-	std::string InputEventData::GetName() const {
+	const std::string& InputEventData::GetName() const {
 		return this->name;
 	}
 
-	unordered_set<std::uint32_t> InputEventData::GetKeys() {
-		return keys;
+	const InputKeys& InputEventData::GetKeys() const {
+		return this->keys;
 	}
 
-	BlockCondition InputEventData::ShouldBlock() {
+	BlockCondition InputEventData::ShouldBlock() const {
 		return this->blockinput;
 	}
 
@@ -303,8 +322,19 @@ namespace Gts {
 	void InputManager::RegisterInputEvent(std::string_view namesv, std::function<void(const InputEventData&)> callback, std::function<bool(void)> condition) {
 		auto& me = InputManager::GetSingleton();
 		std::string name(namesv);
-		me.registedInputEvents.try_emplace(name, callback, condition);
-		log::debug("Registered input event: {}", namesv);
+		auto [_, inserted] = me.inputEventIndices.try_emplace(name, me.registedInputEvents.size());
+		if (inserted) {
+			me.registedInputEvents.emplace_back(callback, condition);
+			me.ResolveTriggers();
+		}
+		GTS_LOG_DEBUG("Registered input event: {}", namesv);
+	}
+
+	void InputManager::ResolveTriggers() {
+		for (auto& trigger: this->keyTriggers) {
+			auto found = this->inputEventIndices.find(trigger.GetName());
+			trigger.eventIndex = found != this->inputEventIndices.end() ? found->second : InputEventData::NO_EVENT;
+		}
 	}
 
 	void InputManager::DataReady() {
@@ -327,20 +357,18 @@ namespace Gts {
 			return;
 		}
 
+		this->ResolveTriggers();
 		log::info("Loaded {} key bindings", InputManager::GetSingleton().keyTriggers.size());
 		
 		Ready = true;
 	}
 
 	void InputManager::ProcessEvents(InputEvent** a_event) {
-		std::unordered_set<uint32_t> KeysToBlock = {};
-		std::unordered_set<std::uint32_t> gameInputKeys = {};
-		RE::InputEvent* event = *a_event;
-		RE::InputEvent* prev = nullptr;
-
-		if (Plugin::AnyMenuOpen() || !a_event || !Ready) {
+		if (!a_event || Plugin::AnyMenuOpen() || !Ready) {
 			return;
 		}
+		InputKeys gameInputKeys = {};
+		InputKeys keysToBlock = {};
 
 		//Get Current InputKeys
 		for (auto event = *a_event; event; event = event->next) {
@@ -355,108 +383,79 @@ namespace Gts {
 				continue;
 			}
 
-			//If it is a ButtonEvent add it to to the list of pressed keys
-			if (buttonEvent->device.get() == INPUT_DEVICE::kKeyboard) {
-				auto key = buttonEvent->GetIDCode();
-				gameInputKeys.emplace(key);
-			}
-			else if (buttonEvent->device.get() == INPUT_DEVICE::kMouse) {
-				auto key = buttonEvent->GetIDCode();
-				gameInputKeys.emplace(key + MOUSE_OFFSET);
+			//If it is a ButtonEvent add it to to the pressed keys
+			std::size_t key = GetKeyIndex(buttonEvent);
+			if (key < INPUT_KEY_COUNT) {
+				gameInputKeys.set(key);
 			}
 		}
 
 		for (auto& trigger : this->keyTriggers) {
-			// Store triggers in here that have been fired this frame
-			std::vector<InputEventData*> firedTriggers; 
 			auto blockInput = trigger.ShouldBlock();
 
 			//Are all keys pressed for this trigger and are we allowed to selectively block?
 			//if never: behavior defaults to old implementation
-			if (trigger.AllKeysPressed(gameInputKeys)){
+			if (trigger.AllKeysPressed(gameInputKeys)) {
 				//log::debug("AllkeysPressed for trigger {}", trigger.GetName());
+				if (trigger.eventIndex == InputEventData::NO_EVENT) {
+					log::warn("Event {} was triggered but there is no event of that name", trigger.GetName());
+					continue;
+				}
 				//Get the coresponding event data
-				try {
-					auto& eventData = this->registedInputEvents.at(trigger.GetName());
-
-					if (blockInput == BlockCondition::Force) {
-						//If force blocking is set block game input regardless of conditions
-						std::unordered_set<uint32_t> KeysToAdd = std::unordered_set<uint32_t>(trigger.GetKeys());
-						KeysToBlock.insert(KeysToAdd.begin(), KeysToAdd.end());
-
-						if (eventData.condition != nullptr) {
-							if (!eventData.condition()) {
-								continue;
-							}
-						}
+				auto& eventData = this->registedInputEvents[trigger.eventIndex];
 
-					}
-					//The condition callback can be null, check before calling it.
-					//In the case it's null input blocking or early continuing won't be done and the system will behave like previously unless its forced.
-					else if (eventData.condition != nullptr) {
-						//log::debug("condition exists {}", fmt::ptr(&eventData.condition));
-						//Used to verify wether this trigger will actually end up doing anthing
-						if (eventData.condition()) {
-							//log::debug("condition is true for {}", trigger.GetName());
-							//Need to make a copy here otherwise insert throws an assertion
-
-							if (blockInput != BlockCondition::Never) {
-								std::unordered_set<uint32_t> KeysToAdd = std::unordered_set<uint32_t>(trigger.GetKeys());
-								//log::debug("ShouldBlock is true for {}", trigger.GetName());
-								KeysToBlock.insert(KeysToAdd.begin(), KeysToAdd.end());
-							}
-						}
-						else {
-							//log::debug("Condition Was False For Event: {}", trigger.GetName());
-							//If False Skip calling ShouldFire as there is no point in processing an event that won't do anything
+				if (blockInput == BlockCondition::Force) {
+					//If force blocking is set block game input regardless of conditions
+					keysToBlock |= trigger.GetKeys();
+
+					if (eventData.condition != nullptr) {
+						if (!eventData.condition()) {
 							continue;
 						}
 					}
 				}
-
-				catch (std::out_of_range e) {
-					log::warn("Event {} was triggered but there is no event of that name", trigger.GetName());
-					continue;
+				//The condition callback can be null, check before calling it.
+				//In the case it's null input blocking or early continuing won't be done and the system will behave like previously unless its forced.
+				else if (eventData.condition != nullptr) {
+					//Used to verify wether this trigger will actually end up doing anthing
+					if (eventData.condition()) {
+						if (blockInput != BlockCondition::Never) {
+							keysToBlock |= trigger.GetKeys();
+						}
+					}
+					else {
+						//If False Skip calling ShouldFire as there is no point in processing an event that won't do anything
+						continue;
+					}
 				}
 			}
 
 			//Handles Event tiggering conditions
 			if (trigger.ShouldFire(gameInputKeys)) {
-				bool groupAlreadyFired = false;
-				for (auto firedTrigger : firedTriggers) {
-					if (trigger.SameGroup(*firedTrigger)) {
-						groupAlreadyFired = true;
-						break;
-					}
-				}
-				if (groupAlreadyFired) {
-					trigger.Reset();
-				}
-				else {
-					log::debug("Running event {}", trigger.GetName());
-					firedTriggers.push_back(&trigger);
-					try {
-						auto& eventData = this->registedInputEvents.at(trigger.GetName());
-						eventData.callback(trigger);
-					}
-					catch (std::out_of_range e) {
-						log::warn("Event {} was triggered but there is no event of that name", trigger.GetName());
-						continue;
-					}
+				if (trigger.eventIndex == InputEventData::NO_EVENT) {
+					log::warn("Event {} was triggered but there is no event of that name", trigger.GetName());
+					continue;
 				}
+				GTS_LOG_DEBUG("Running event {}", trigger.GetName());
+				this->registedInputEvents[trigger.eventIndex].callback(trigger);
 			}
 		}
 
+		if (keysToBlock.none()) {
+			return;
+		}
+
+		RE::InputEvent* event = *a_event;
+		RE::InputEvent* prev = nullptr;
 		while (event != nullptr) {
 			bool shouldDispatch = true;
-			auto eventType = event->eventType;
 			if (event->eventType == RE::INPUT_EVENT_TYPE::kButton) {
 				const auto button = static_cast<RE::ButtonEvent*>(event);
 				if (button) {
-					uint32_t input = button->GetIDCode();
-					if (KeysToBlock.find(input) != KeysToBlock.end()) {
-						logger::debug("Blocked Input For Key {}", input);
-							shouldDispatch = false;
+					std::size_t key = GetKeyIndex(button);
+					if (key < INPUT_KEY_COUNT && keysToBlock.test(key)) {
+						GTS_LOG_DEBUG("Blocked Input For Key {}", button->GetIDCode());
+						shouldDispatch = false;
 					}
 				}
 			}
@@ -26,6 +26,9 @@ namespace Gts
 		Force,
 	};
 
+	// Pressed state of every keyboard, mouse (MOUSE_OFFSET) and gamepad (GAMEPAD_OFFSET) key
+	using InputKeys = std::bitset<INPUT_KEY_COUNT>;
+
 	class InputEventData {
 		public:
 			// Construct from toml::table (toml11)
@@ -34,17 +37,17 @@ namespace Gts
 			// Return time since it was first pressed
 			float Duration() const;
 
-			// Will take a key list and process if the event should fire.
+			// Will take the pressed keys and process if the event should fire.
 			//   will return true if the events conditions are met
-			bool ShouldFire(const std::unordered_set<std::uint32_t>& keys);
+			bool ShouldFire(const InputKeys& keys);
 
 			// Returns true if all keys are pressed this frame
 			//  Not taking into account things like duration
-			bool AllKeysPressed(const std::unordered_set<std::uint32_t>& keys);
+			bool AllKeysPressed(const InputKeys& keys) const;
 
 			// Returns true if ONLY the specicified keys are pressed this frame
 			//   Not taking into account things like duration
-			bool OnlyKeysPressed(const std::unordered_set<std::uint32_t>& keys);
+			bool OnlyKeysPressed(const InputKeys& keys) const;
 
 			// Resets the timer and all appropiate state variables
 			void Reset();
@@ -54,7 +57,7 @@ namespace Gts
 
 			// Returns if the event is a onup event
 			bool IsOnUp() const;
-			std::string GetName() const;
+			const std::string& GetName() const;
 
 			// Check if this is an On key up event
 			//bool IsOnUp();
@@ -64,12 +67,15 @@ namespace Gts
 			// of mutaally exclusive triggers
 			bool SameGroup(const InputEventData& other) const;
 
-			unordered_set<std::uint32_t> GetKeys();
+			const InputKeys& GetKeys() const;
 
-			BlockCondition ShouldBlock();
+			BlockCondition ShouldBlock() const;
 		private:
+			friend class InputManager;
+			static constexpr std::size_t NO_EVENT = std::numeric_limits<std::size_t>::max();
+
 			std::string name = "";
-			unordered_set<std::uint32_t> keys = {};
+			InputKeys keys = {};
 			float minDuration = 0.0f;
 			double startTime = 0.0;
 			// If true this event won't fire unles ONLY the keys are pressed for the entire duration
@@ -78,6 +84,8 @@ namespace Gts
 			InputEventState state = InputEventState::Idle;
 			bool primed = false; // Used for release events. Once primed, when keys are not pressed we fire
 			BlockCondition blockinput = BlockCondition::Default;
+			// Index in InputManager::registedInputEvents, resolved when loaded/registered
+			std::size_t eventIndex = NO_EVENT;
 	};
 
 	//enum InputEventConditions {
@@ -109,7 +117,13 @@ namespace Gts
 
 			static void RegisterInputEvent(std::string_view name, std::function<void(const InputEventData&)> callback, std::function<bool(void)> condition = nullptr);
 
-			std::unordered_map<std::string, RegisteredInputEvent> registedInputEvents;
+			// Registered events are never removed, the triggers refer to them by index
+			std::vector<RegisteredInputEvent> registedInputEvents;
+			std::unordered_map<std::string, std::size_t> inputEventIndices;
 			std::vector<InputEventData> keyTriggers;
+
+		private:
+			// Points every trigger at its registered event
+			void ResolveTriggers();
 	};
 }
@@ -1,5 +1,6 @@
 #include "managers/MaxSizeManager.hpp"
 #include "managers/ai/aifunctions.hpp"
+#include "utils/UpdateScheduler.hpp"
 #include "utils/actorUtils.hpp"
 #include "data/persistent.hpp"
 #include "data/runtime.hpp"
@@ -60,7 +61,9 @@ namespace {
 namespace Gts {
     void UpdateMaxScale() {
         auto profiler = Profilers::Profile("SizeManager: Update");
-		for (auto actor: find_actors()) {
+		// Distant small NPCs pick up a changed limit a few frames later
+		static const UpdateTaskId task = UpdateScheduler::Register(UpdateTask { .name = "SizeManager: Update" });
+		UpdateScheduler::Run(task, [](Actor* actor, std::uint64_t) {
 			// 2023 + 2024: TODO: move away from polling
 			float Endless = 0.0f;
 			if (actor->formID == 0x14) {
@@ -91,6 +94,6 @@ namespace Gts {
 			if (get_max_scale(actor) < TotalLimit + Endless || get_max_scale(actor) > TotalLimit + Endless) {
 				set_max_scale(actor, TotalLimit);
 			}
-		}
+		});
     }
 }
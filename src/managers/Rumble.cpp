@@ -31,7 +31,7 @@ namespace Gts {
 	}
 
 	void RumbleData::ChangeTargetIntensity(float intensity) {
-		this->currentIntensity.target = intensity;
+		this->currentIntensity.SetTarget(intensity);
 		this->state = RumbleState::RampingUp;
 		this->startTime = 0.0f;
 	}
@@ -103,7 +103,7 @@ namespace Gts {
 				switch (rumbleData.state) {
 					case RumbleState::RampingUp: {
 						// Increasing intensity just let the spring do its thing
-						if (fabs(rumbleData.currentIntensity.value - rumbleData.currentIntensity.target) < 1e-3) {
+						if (fabs(rumbleData.currentIntensity.GetValue() - rumbleData.currentIntensity.GetTarget()) < 1e-3) {
 							// When spring is done move the state onwards
 							rumbleData.state = RumbleState::Rumbling;
 							rumbleData.startTime = Time::WorldTimeElapsed();
@@ -112,7 +112,7 @@ namespace Gts {
 					}
 					case RumbleState::Rumbling: {
 						// At max intensity
-						rumbleData.currentIntensity.value = rumbleData.currentIntensity.target;
+						rumbleData.currentIntensity.SetValue(rumbleData.currentIntensity.GetTarget());
 						if (Time::WorldTimeElapsed() > rumbleData.startTime + rumbleData.duration) {
 							rumbleData.state = RumbleState::RampingDown;
 						}
@@ -120,8 +120,8 @@ namespace Gts {
 					}
 					case RumbleState::RampingDown: {
 						// Stoping the rumbling
-						rumbleData.currentIntensity.target = 0; // Ensure ramping down is going to zero intensity
-						if (fabs(rumbleData.currentIntensity.value) <= 1e-3) {
+						rumbleData.currentIntensity.SetTarget(0); // Ensure ramping down is going to zero intensity
+						if (fabs(rumbleData.currentIntensity.GetValue()) <= 1e-3) {
 							// Stopped
 							rumbleData.state = RumbleState::Still;
 						}
@@ -148,7 +148,7 @@ namespace Gts {
 				auto node = find_node(actor, rumbleData.node);
 				if (node) {
 					cummulativeIntensity.try_emplace(node);
-					cummulativeIntensity.at(node) += rumbleData.currentIntensity.value;
+					cummulativeIntensity.at(node) += rumbleData.currentIntensity.GetValue();
 				}
 			}
 			// Now do the rumble
@@ -8,6 +8,7 @@
 #include "managers/CrushManager.hpp"
 #include "magic/effects/common.hpp"
 #include "managers/explosion.hpp"
+#include "utils/TargetQuery.hpp"
 #include "utils/actorUtils.hpp"
 #include "data/persistent.hpp"
 #include "managers/tremor.hpp"
@@ -24,7 +25,6 @@
 namespace {
 	const float MINIMUM_SANDWICH_DISTANCE = 70.0f;
 	const float SANDWICH_ANGLE = 60;
-	const float PI = 3.14159f;
 
 	void CantThighSandwichPlayerMessage(Actor* giant, Actor* tiny, float sizedifference) {
 		if (sizedifference < Action_Sandwich) {
@@ -217,73 +217,19 @@ namespace Gts {
 			return {};
 		}
 
-		NiPoint3 predPos = pred->GetPosition();
-
-		auto preys = find_actors();
-
-		// Sort prey by distance
-		sort(preys.begin(), preys.end(),
-		     [predPos](const Actor* preyA, const Actor* preyB) -> bool
-		{
-			float distanceToA = (preyA->GetPosition() - predPos).Length();
-			float distanceToB = (preyB->GetPosition() - predPos).Length();
-			return distanceToA < distanceToB;
+		// CanSandwich rejects anything further than this, it still does the exact check
+		auto preys = QueryTargets(pred, TargetQuery {
+			.radius = MINIMUM_SANDWICH_DISTANCE * 1.75f * get_visual_scale(pred),
+			.coneAngle = SANDWICH_ANGLE,
+			.coneWidth = 70 * get_visual_scale(pred),
+			.limit = (numberOfPrey == 1) ? TargetQuery::ALL : numberOfPrey,
+		}, [pred, this](Actor* prey) {
+			return this->CanSandwich(pred, prey);
 		});
 
-		// Filter out invalid targets
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[pred, this](auto prey)
-		{
-			return !this->CanSandwich(pred, prey);
-		}), preys.end());
-
-		// Filter out actors not in front
-		auto actorAngle = pred->data.angle.z;
-		RE::NiPoint3 forwardVector{ 0.f, 1.f, 0.f };
-		RE::NiPoint3 actorForward = RotateAngleAxis(forwardVector, -actorAngle, { 0.f, 0.f, 1.f });
-
-		NiPoint3 predDir = actorForward;
-		predDir = predDir / predDir.Length();
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[predPos, predDir](auto prey)
-		{
-			NiPoint3 preyDir = prey->GetPosition() - predPos;
-			if (preyDir.Length() <= 1e-4) {
-				return false;
-			}
-			preyDir = preyDir / preyDir.Length();
-			float cosTheta = predDir.Dot(preyDir);
-			return cosTheta <= 0; // 180 degress
-		}), preys.end());
-
-		// Filter out actors not in a truncated cone
-		// \      x   /
-		//  \  x     /
-		//   \______/  <- Truncated cone
-		//   | pred |  <- Based on width of pred
-		//   |______|
-		float predWidth = 70 * get_visual_scale(pred);
-		float shiftAmount = fabs((predWidth / 2.0f) / tan(SANDWICH_ANGLE/2.0f));
-
-		NiPoint3 coneStart = predPos - predDir * shiftAmount;
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[coneStart, predWidth, predDir](auto prey)
-		{
-			NiPoint3 preyDir = prey->GetPosition() - coneStart;
-			if (preyDir.Length() <= predWidth*0.4f) {
-				return false;
-			}
-			preyDir = preyDir / preyDir.Length();
-			float cosTheta = predDir.Dot(preyDir);
-			return cosTheta <= cos(SANDWICH_ANGLE*PI/180.0f);
-		}), preys.end());
-
 		if (numberOfPrey == 1) {
 			return Vore_GetMaxVoreCount(pred, preys);
 		}
-		
-		// Reduce vector size
-		if (preys.size() > numberOfPrey) {
-			preys.resize(numberOfPrey);
-		}
-
 		return preys;
 	}
 
@@ -386,7 +332,7 @@ namespace Gts {
 		this->RuneShrink = enable;
 	}
 	void SandwichingData::OverideShrinkRune(float value) {
-		this->ScaleRune.value = value;
+		this->ScaleRune.SetValue(value);
 	}
 
 	SandwichingData& ThighSandwichController::GetSandwichingData(Actor* giant) {
@@ -11,6 +11,7 @@
 #include "managers/CrushManager.hpp"
 #include "managers/explosion.hpp"
 #include "managers/audio/footstep.hpp"
+#include "utils/TargetQuery.hpp"
 #include "utils/actorUtils.hpp"
 #include "managers/tremor.hpp"
 #include "managers/Rumble.hpp"
@@ -28,7 +29,6 @@ namespace {
 	const float MINIMUM_STOMP_DISTANCE = 50.0f;
 	const float MINIMUM_STOMP_SCALE_RATIO = 1.5f;
 	const float STOMP_ANGLE = 50;
-	const float PI = 3.14159f;
 
 	bool CanStompDead(Actor* tiny, float sizedifference) {
 		if (tiny->IsDead() && sizedifference < Action_Crush) {
@@ -153,68 +153,19 @@ namespace Gts {
 		if (!charController) {
 			return {};
 		}
-		NiPoint3 predPos = pred->GetPosition();
-		auto preys = find_actors();
-		// Sort prey by distance
-		sort(preys.begin(), preys.end(),
-		     [predPos](const Actor* preyA, const Actor* preyB) -> bool
-		{
-			float distanceToA = (preyA->GetPosition() - predPos).Length();
-			float distanceToB = (preyB->GetPosition() - predPos).Length();
-			return distanceToA < distanceToB;
+		// CanStomp rejects anything further than this, it still does the exact check
+		auto preys = QueryTargets(pred, TargetQuery {
+			.radius = MINIMUM_STOMP_DISTANCE * 2.0f * get_visual_scale(pred),
+			.coneAngle = STOMP_ANGLE,
+			.coneWidth = 70 * get_visual_scale(pred),
+			.limit = (numberOfPrey == 1) ? TargetQuery::ALL : numberOfPrey,
+		}, [pred, this](Actor* prey) {
+			return this->CanStomp(pred, prey);
 		});
 
-		// Filter out invalid targets
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[pred, this](auto prey)
-		{
-			return !this->CanStomp(pred, prey);
-		}), preys.end());
-
-		// Filter out actors not in front
-		auto actorAngle = pred->data.angle.z;
-		RE::NiPoint3 forwardVector{ 0.f, 1.f, 0.f };
-		RE::NiPoint3 actorForward = RotateAngleAxis(forwardVector, -actorAngle, { 0.f, 0.f, 1.f });
-
-		NiPoint3 predDir = actorForward;
-		predDir = predDir / predDir.Length();
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[predPos, predDir](auto prey)
-		{
-			NiPoint3 preyDir = prey->GetPosition() - predPos;
-			if (preyDir.Length() <= 1e-4) {
-				return false;
-			}
-			preyDir = preyDir / preyDir.Length();
-			float cosTheta = predDir.Dot(preyDir);
-			return cosTheta <= 0; // 180 degress
-		}), preys.end());
-		// Filter out actors not in a truncated cone
-		// \      x   /
-		//  \  x     /
-		//   \______/  <- Truncated cone
-		//   | pred |  <- Based on width of pred
-		//   |______|
-		float predWidth = 70 * get_visual_scale(pred);
-		float shiftAmount = fabs((predWidth / 2.0f) / tan(STOMP_ANGLE/2.0f));
-		NiPoint3 coneStart = predPos - predDir * shiftAmount;
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[coneStart, predWidth, predDir](auto prey)
-		{
-			NiPoint3 preyDir = prey->GetPosition() - coneStart;
-			if (preyDir.Length() <= predWidth*0.4f) {
-				return false;
-			}
-			preyDir = preyDir / preyDir.Length();
-			float cosTheta = predDir.Dot(preyDir);
-			return cosTheta <= cos(STOMP_ANGLE*PI/180.0f);
-		}), preys.end());
-		// Reduce vector size
-
 		if (numberOfPrey == 1) {
 			return Vore_GetMaxVoreCount(pred, preys);
 		}
-
-		if (preys.size() > numberOfPrey) {
-			preys.resize(numberOfPrey);
-		}
 		return preys;
 	}
 
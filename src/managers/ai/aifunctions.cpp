@@ -10,6 +10,7 @@
 #include "utils/actorUtils.hpp"
 #include "utils/actorBools.hpp"
 #include "utils/findActor.hpp"
+#include "utils/ActorGrid.hpp"
 #include "data/persistent.hpp"
 #include "data/transient.hpp"
 #include "utils/random.hpp"
@@ -309,13 +310,16 @@ namespace Gts {
 		if (!Persistent::GetSingleton().actors_panic) {
 			return; // Disallow Panic if bool is false.
 		}
-		for (auto tiny: FindSomeActors("AiActors", 2)) {
+		// Size difference is clamped to 12 below, so nobody past that range can ever be scared
+		float max_scare_distance = 128.0f * GetMovementModifier(giant) * 12.0f;
+		// Only actors in range can be scared, so every one of them is checked each call
+		for (auto tiny: ActorGrid::FindActorsInRange(giant->GetPosition(), max_scare_distance)) {
 			if (tiny != giant && tiny->formID != 0x14 && !IsTeammate(tiny)) {
 				if (tiny->IsDead() || IsInSexlabAnim(tiny, giant)) {
-					return;
+					continue;
 				}
 				if (IsBeingHeld(giant, tiny)) {
-					return;
+					continue;
 				}
 				float get_difference = GetSizeDifference(giant, tiny, SizeType::VisualScale, false, true); // Apply HH difference as well
 				float sizedifference = std::clamp(get_difference, 0.10f, 12.0f);
@@ -159,16 +159,16 @@ namespace {
 			
 			} else {
 				// Not in dialog
-				if (fabs(data.spineSmooth.value) < 1e-3) {
+				if (fabs(data.spineSmooth.GetValue()) < 1e-3) {
 					// Finihed smoothing back to zero
 					giant->SetGraphVariableBool("GTSIsInDialogue", false); // Disallow
 					//log::info("Setting InDialogue to false");
 				}
 			}
-			//log::info("Pitch Override of {} is {}", giant->GetDisplayFullName(), data.spineSmooth.value);
+			//log::info("Pitch Override of {} is {}", giant->GetDisplayFullName(), data.spineSmooth.GetValue());
 		}
-		data.spineSmooth.target = finalAngle;
-		giant->SetGraphVariableFloat("GTSPitchOverride", data.spineSmooth.value);
+		data.spineSmooth.SetTarget(finalAngle);
+		giant->SetGraphVariableFloat("GTSPitchOverride", data.spineSmooth.GetValue());
 	}
 
 	/*void RotateCaster(Actor* giant, HeadtrackingData& data) { // Unused
@@ -208,8 +208,8 @@ namespace {
 				}
 			}
 		}
-		// data.casterSmooth.target = finalAngle;
-		data.casterSmooth.target = PI*1.5f;
+		// data.casterSmooth.SetTarget(finalAngle);
+		data.casterSmooth.SetTarget(PI*1.5f);
 
 		for (auto casterSourceType: {MagicSystem::CastingSource::kLeftHand, MagicSystem::CastingSource::kRightHand}) {
 			auto casterSource = giant->GetMagicCaster(casterSourceType);
@@ -217,8 +217,8 @@ namespace {
 				auto casterNode = casterSource->GetMagicNode();
 				if (casterNode) {
 					auto targetRotation = NiMatrix3();
-					if (data.casterSmooth.value > 1e-3) {
-						targetRotation.SetEulerAnglesXYZ(data.casterSmooth.value, 0.0f, 0.0f);
+					if (data.casterSmooth.GetValue() > 1e-3) {
+						targetRotation.SetEulerAnglesXYZ(data.casterSmooth.GetValue(), 0.0f, 0.0f);
 					}
 					casterNode->local.rotate = targetRotation;
 					casterNode->world.rotate = targetRotation;
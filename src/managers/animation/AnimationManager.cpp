@@ -61,9 +61,9 @@ namespace {
 namespace Gts {
 	AnimationEventData::AnimationEventData(Actor& giant, TESObjectREFR* tiny) : giant(giant), tiny(tiny) {
 	}
-	AnimationEvent::AnimationEvent(std::function<void(AnimationEventData&)> a_callback,  std::string a_group) : callback(a_callback), group(a_group) {
+	AnimationEvent::AnimationEvent(std::function<void(AnimationEventData&)> a_callback,  std::string a_group, AnimationGroupId a_groupId) : callback(a_callback), group(a_group), groupId(a_groupId) {
 	}
-	TriggerData::TriggerData( std::vector< std::string_view> behavors,  std::string_view group) : behavors({}), group(group) {
+	TriggerData::TriggerData( std::vector< std::string_view> behavors,  std::string_view group, AnimationGroupId groupId) : behavors({}), group(group), groupId(groupId) {
 		for (auto& sv: behavors) {
 			this->behavors.push_back(std::string(sv));
 		}
@@ -194,38 +194,71 @@ namespace Gts {
 		this->data.erase(actor);
 	}
 
+	AnimationGroupId AnimationManager::GetGroupId(std::string_view group) {
+		auto found = this->groupIds.find(group);
+		if (found != this->groupIds.end()) {
+			return found->second;
+		}
+		AnimationGroupId id = static_cast<AnimationGroupId>(this->groupIds.size());
+		this->groupIds.try_emplace(std::string(group), id);
+		return id;
+	}
+
+	AnimationManager::ActorAnimData& AnimationManager::GetActorData(Actor* actor) {
+		auto& actorData = this->data[actor];
+		if (actorData.size() < this->groupIds.size()) {
+			actorData.resize(this->groupIds.size());
+		}
+		return actorData;
+	}
+
+	AnimationManager::ActorAnimData* AnimationManager::FindActorData(Actor* actor) {
+		auto found = this->data.find(actor);
+		if (found != this->data.end()) {
+			return &found->second;
+		}
+		return nullptr;
+	}
+
 	float AnimationManager::GetHighHeelSpeed(Actor* actor) {
 		float Speed = 1.0f;
-		try {
-			for (auto& [tag, data]: AnimationManager::GetSingleton().data.at(actor)) {
-				Speed *= data.HHspeed;
+		auto actorData = AnimationManager::GetSingleton().FindActorData(actor);
+		if (actorData) {
+			for (auto& data: *actorData) {
+				if (data) {
+					Speed *= data->HHspeed;
+				}
 			}
-		} catch (std::out_of_range e) {
 		}
 		return Speed;
 	}
 
 	float AnimationManager::GetBonusAnimationSpeed(Actor* actor) {
 		float totalSpeed = 1.0f;
-		try {
-			for (auto& [tag, data]: AnimationManager::GetSingleton().data.at(actor)) {
-				totalSpeed *= data.animSpeed;
+		auto actorData = AnimationManager::GetSingleton().FindActorData(actor);
+		if (actorData) {
+			for (auto& data: *actorData) {
+				if (data) {
+					totalSpeed *= data->animSpeed;
+				}
 			}
-		} catch (std::out_of_range e) {
 		}
 		return totalSpeed;
 	}
 
 	void AnimationManager::AdjustAnimSpeed(float bonus) {
 		auto player = PlayerCharacter::GetSingleton();
-		try {
-			for (auto& [tag, data]: AnimationManager::GetSingleton().data.at(player)) {
-				if (data.canEditAnimSpeed) {
-					data.animSpeed += (bonus*GetAnimationSlowdown(player));
+		auto actorData = AnimationManager::GetSingleton().FindActorData(player);
+		if (actorData) {
+			for (auto& data: *actorData) {
+				if (data) {
+					if (data->canEditAnimSpeed) {
+						data->animSpeed += (bonus*GetAnimationSlowdown(player));
+					}
+					data->animSpeed = std::clamp(data->animSpeed, 0.33f, 3.0f);
 				}
-				data.animSpeed = std::clamp(data.animSpeed, 0.33f, 3.0f);
 			}
-		} catch (std::out_of_range e) {}
+		}
 	}
 
 	float AnimationManager::GetAnimSpeed(Actor* actor) {
@@ -241,20 +274,18 @@ namespace Gts {
 				}
 			}
 
-			try {
-				float totalSpeed = 1.0f;
-				for (auto& [tag, data]: AnimationManager::GetSingleton().data.at(actor)) {
-					totalSpeed *= data.animSpeed;
-				}
-				speed *= totalSpeed;
-			} catch (std::out_of_range e) {
-			}
+			speed *= AnimationManager::GetBonusAnimationSpeed(actor);
 		}
 		return speed;
 	}
 
 	void AnimationManager::RegisterEvent( std::string_view name,  std::string_view group, std::function<void(AnimationEventData&)> func) {
-		AnimationManager::GetSingleton().eventCallbacks.try_emplace(std::string(name), func, std::string(group));
+		auto& me = AnimationManager::GetSingleton();
+		auto& event = me.events.emplace_back(func, std::string(group), me.GetGroupId(group));
+		if (!me.eventCallbacks.Add(name, &event)) {
+			// Already registered, first one wins
+			me.events.pop_back();
+		}
 		//log::info("Registering Event: Name {}, Group {}", name, group);
 	}
 
@@ -265,7 +296,8 @@ namespace Gts {
 
 	void AnimationManager::RegisterTriggerWithStages( std::string_view trigger,  std::string_view group,  std::vector< std::string_view> behaviors) {
 		if (behaviors.size() > 0) {
-			AnimationManager::GetSingleton().triggers.try_emplace(std::string(trigger), behaviors, group);
+			auto& me = AnimationManager::GetSingleton();
+			me.triggers.try_emplace(std::string(trigger), behaviors, group, me.GetGroupId(group));
 			//log::info("Registering Trigger With Stages: {}, Group {}", trigger, group);
 		}
 	}
@@ -292,27 +324,26 @@ namespace Gts {
 				return; // Don't start animations in FP, it's not supported.
 			}
 		}
-		try {
-			auto& me = AnimationManager::GetSingleton();
-			// Find the behavior for this trigger exit on catch if not
-
-			auto& behavorToPlay = me.triggers.at(std::string(trigger));
-			auto& group = behavorToPlay.group;
-			// Try to create anim data for actor
-			me.data.try_emplace(&giant);
-			auto& actorData = me.data.at(&giant); // Must exists now
-			// Create the anim data for this group if not present
-			actorData.try_emplace(group, giant, tiny);
-			// Run the anim
-			//log::info("Playing Trigger {} for {}", trigger, giant.GetDisplayFullName());
-			//log::info("Playing {}", behavorToPlay.behavors[0]);
-			giant.NotifyAnimationGraph(behavorToPlay.behavors[0]);
-
-			PerkHandler::UpdatePerkValues(&giant, PerkUpdate::Perk_Acceleration); // Currently used for Anim Speed buff only
-		} catch (std::out_of_range) {
+		auto& me = AnimationManager::GetSingleton();
+		// Find the behavior for this trigger
+		auto found = me.triggers.find(trigger);
+		if (found == me.triggers.end()) {
 			log::error("Requested play of unknown animation named: {}", trigger);
 			return;
 		}
+		auto& behavorToPlay = found->second;
+		// Create the anim data for this group if not present
+		auto& actorData = me.GetActorData(&giant);
+		auto& groupData = actorData[behavorToPlay.groupId];
+		if (!groupData) {
+			groupData.emplace(giant, tiny);
+		}
+		// Run the anim
+		//log::info("Playing Trigger {} for {}", trigger, giant.GetDisplayFullName());
+		//log::info("Playing {}", behavorToPlay.behavors[0]);
+		giant.NotifyAnimationGraph(behavorToPlay.behavors[0]);
+
+		PerkHandler::UpdatePerkValues(&giant, PerkUpdate::Perk_Acceleration); // Currently used for Anim Speed buff only
 	}
 	void AnimationManager::StartAnim(std::string_view trigger, Actor* giant, TESObjectREFR* tiny) {
 		if (giant) {
@@ -321,23 +352,27 @@ namespace Gts {
 	}
 
 	void AnimationManager::NextAnim(std::string_view trigger, Actor& giant) {
-		try {
-			auto& me = AnimationManager::GetSingleton();
-			// Find the behavior for this trigger exit on catch if not
-			auto& behavorToPlay = me.triggers.at(std::string(trigger));
-			auto& group = behavorToPlay.group;
-			// Get the actor data OR exit on catch
-			auto& actorData = me.data.at(&giant);
-			// Get the event data of exit on catch
-			auto& eventData = actorData.at(group);
-			std::size_t currentTrigger = eventData.currentTrigger;
-			// Run the anim
-			if (behavorToPlay.behavors.size() < currentTrigger) {
-				giant.NotifyAnimationGraph(behavorToPlay.behavors[currentTrigger]);
-			}
-		} catch (std::out_of_range) {
+		auto& me = AnimationManager::GetSingleton();
+		// Find the behavior for this trigger
+		auto found = me.triggers.find(trigger);
+		if (found == me.triggers.end()) {
+			return;
+		}
+		auto& behavorToPlay = found->second;
+		// Get the event data of the group
+		auto actorData = me.FindActorData(&giant);
+		if (!actorData || behavorToPlay.groupId >= actorData->size()) {
+			return;
+		}
+		auto& eventData = (*actorData)[behavorToPlay.groupId];
+		if (!eventData) {
 			return;
 		}
+		std::size_t currentTrigger = eventData->currentTrigger;
+		// Run the anim
+		if (behavorToPlay.behavors.size() < currentTrigger) {
+			giant.NotifyAnimationGraph(behavorToPlay.behavors[currentTrigger]);
+		}
 	}
 	void AnimationManager::NextAnim(std::string_view trigger, Actor* giant) {
 		if (giant) {
@@ -346,37 +381,39 @@ namespace Gts {
 	}
 
 	void AnimationManager::ActorAnimEvent(Actor* actor, const std::string_view& tag, const std::string_view& payload) {
-		try {
-			if (actor) {
-				// Try to get the registerd anim for this tag
-				auto& animToPlay = this->eventCallbacks.at(std::string(tag));
-				// If data dosent exist then insert with default
-				this->data.try_emplace(actor);
-				auto& actorData = this->data.at(actor);
-				auto group = animToPlay.group;
-				// If data dosent exist this will insert it with default
-				actorData.try_emplace(group, *actor, nullptr);
-				// Get the data or the newly inserted data
-				auto& data = actorData.at(group);
-				// Call the anims function
-				animToPlay.callback(data);
-				// If the stage is 0 after an anim has been played then
-				//   delete this data so that we can reset for the next anim
-				if (data.stage == 0) {
-					actorData.erase(group);
-				}
-			}
-		} catch (std::out_of_range e) {}
+		if (!actor) {
+			return;
+		}
+		// Try to get the registerd anim for this tag, most tags are vanilla ones that end here
+		auto animToPlay = this->eventCallbacks.Find(tag);
+		if (!animToPlay) {
+			return;
+		}
+		auto& actorData = this->GetActorData(actor);
+		auto& data = actorData[animToPlay->groupId];
+		// If data dosent exist this will insert it with default
+		if (!data) {
+			data.emplace(*actor, nullptr);
+		}
+		// Call the anims function
+		animToPlay->callback(*data);
+		// If the stage is 0 after an anim has been played then
+		//   delete this data so that we can reset for the next anim
+		if (data && data->stage == 0) {
+			data.reset();
+		}
 	}
 
 	// Get the current stage of an animation group
 	std::size_t AnimationManager::GetStage(Actor& actor,  std::string_view group) {
-		try {
-			auto& me = AnimationManager::GetSingleton();
-			return me.data.at(&actor).at(std::string(group)).stage;
-		} catch (std::out_of_range e) {
+		auto& me = AnimationManager::GetSingleton();
+		auto groupId = me.groupIds.find(group);
+		auto actorData = me.FindActorData(&actor);
+		if (groupId == me.groupIds.end() || !actorData || groupId->second >= actorData->size()) {
 			return 0;
 		}
+		auto& data = (*actorData)[groupId->second];
+		return data ? data->stage : 0;
 	}
 	std::size_t AnimationManager::GetStage(Actor* actor,  std::string_view group) {
 		if (actor) {
@@ -388,18 +425,16 @@ namespace Gts {
 
 	// Check if any currently playing anim disabled the HHs
 	bool AnimationManager::HHDisabled(Actor& actor) {
-		try {
-			auto& me = AnimationManager::GetSingleton();
-			auto& actorData = me.data.at(&actor);
-			for ( auto &[group, data]: actorData) {
-				if (data.disableHH) {
+		auto& me = AnimationManager::GetSingleton();
+		auto actorData = me.FindActorData(&actor);
+		if (actorData) {
+			for (auto& data: *actorData) {
+				if (data && data->disableHH) {
 					return true;
 				}
 			}
-			return false;
-		} catch (std::out_of_range e) {
-			return false;
 		}
+		return false;
 	}
 	bool AnimationManager::HHDisabled(Actor* actor) {
 		if (actor) {
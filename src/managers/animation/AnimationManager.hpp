@@ -1,5 +1,6 @@
 #pragma once
 #include "events.hpp"
+#include "data/runtime.hpp"
 #include <functional>
 
 using namespace std;
@@ -8,6 +9,9 @@ using namespace RE;
 
 namespace Gts
 {
+	// Index of an animation group name, assigned when the group is first registered
+	using AnimationGroupId = std::uint16_t;
+
 	// This data is passed to an animation that is in progress
 	//   It is created when StartAnim is called
 	//   It is destroyed after ActorAnimEvent if stage == 0
@@ -47,8 +51,9 @@ namespace Gts
 		// When an animation is started data with this group name is created for this actor
 		//  At every stage this data will be passed to any animation registered with this groupname for an actor
 		std::string group;
+		AnimationGroupId groupId;
 
-		AnimationEvent(std::function<void(AnimationEventData&)> callback, std::string group);
+		AnimationEvent(std::function<void(AnimationEventData&)> callback, std::string group, AnimationGroupId groupId);
 	};
 
 	// Holds data that links a trigger to a behaviour and group
@@ -59,8 +64,9 @@ namespace Gts
 		std::vector<std::string> behavors;
 		// The name of the data to be created
 		std::string group;
+		AnimationGroupId groupId;
 
-		TriggerData(std::vector<std::string_view> behavors, std::string_view group);
+		TriggerData(std::vector<std::string_view> behavors, std::string_view group, AnimationGroupId groupId);
 	};
 
 	class AnimationManager : public EventListener
@@ -134,9 +140,27 @@ namespace Gts
 			static bool HHDisabled(Actor* actor);
 
 		protected:
-			std::unordered_map<Actor*, std::unordered_map<std::string, AnimationEventData> > data;
-			std::unordered_map<std::string, AnimationEvent> eventCallbacks;
-			std::unordered_map<std::string, TriggerData> triggers;
+			struct NameHash {
+				using is_transparent = void;
+				std::size_t operator()(std::string_view name) const noexcept {
+					return std::hash<std::string_view>{}(name);
+				}
+			};
+			// Indexed by AnimationGroupId, empty when the group is not playing
+			//  Sized to every known group when created so references stay valid during a callback
+			using ActorAnimData = std::vector<std::optional<AnimationEventData>>;
+
+			AnimationGroupId GetGroupId(std::string_view group);
+			ActorAnimData& GetActorData(Actor* actor);
+			// nullptr if the actor has no animation data
+			ActorAnimData* FindActorData(Actor* actor);
+
+			std::unordered_map<Actor*, ActorAnimData> data;
+			// Events are looked up by the hash of the tag, unknown tags are rejected without allocating
+			std::deque<AnimationEvent> events;
+			RuntimeTable<AnimationEvent> eventCallbacks;
+			std::unordered_map<std::string, TriggerData, NameHash, std::equal_to<>> triggers;
+			std::unordered_map<std::string, AnimationGroupId, NameHash, std::equal_to<>> groupIds;
 	};
 
 	void ShakeAndSound(Actor* caster, float volume,  std::string_view& node);
@@ -11,6 +11,7 @@
 #include "managers/CrushManager.hpp"
 #include "managers/explosion.hpp"
 #include "managers/audio/footstep.hpp"
+#include "utils/TargetQuery.hpp"
 #include "utils/actorUtils.hpp"
 #include "data/persistent.hpp"
 #include "managers/tremor.hpp"
@@ -28,7 +29,6 @@ namespace {
 
 	const float MINIMUM_BUTTCRUSH_DISTANCE = 95.0f;
 	const float BUTTCRUSH_ANGLE = 70;
-	const float PI = 3.14159f;
 
 	void AttachToObjectBTask(Actor* giant, Actor* tiny) {
 		std::string name = std::format("ButtCrush_{}", tiny->formID);
@@ -187,73 +187,19 @@ namespace Gts {
 			return {};
 		}
 
-		NiPoint3 predPos = pred->GetPosition();
-
-		auto preys = find_actors();
-
-		// Sort prey by distance
-		sort(preys.begin(), preys.end(),
-		     [predPos](const Actor* preyA, const Actor* preyB) -> bool
-		{
-			float distanceToA = (preyA->GetPosition() - predPos).Length();
-			float distanceToB = (preyB->GetPosition() - predPos).Length();
-			return distanceToA < distanceToB;
+		// CanButtCrush rejects anything further than this, it still does the exact check
+		auto preys = QueryTargets(pred, TargetQuery {
+			.radius = MINIMUM_BUTTCRUSH_DISTANCE * get_visual_scale(pred),
+			.coneAngle = BUTTCRUSH_ANGLE,
+			.coneWidth = 70 * get_visual_scale(pred),
+			.limit = (numberOfPrey == 1) ? TargetQuery::ALL : numberOfPrey,
+		}, [pred, this](Actor* prey) {
+			return this->CanButtCrush(pred, prey);
 		});
 
-		// Filter out invalid targets
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[pred, this](auto prey)
-		{
-			return !this->CanButtCrush(pred, prey);
-		}), preys.end());
-
-		// Filter out actors not in front
-		auto actorAngle = pred->data.angle.z;
-		RE::NiPoint3 forwardVector{ 0.f, 1.f, 0.f };
-		RE::NiPoint3 actorForward = RotateAngleAxis(forwardVector, -actorAngle, { 0.f, 0.f, 1.f });
-
-		NiPoint3 predDir = actorForward;
-		predDir = predDir / predDir.Length();
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[predPos, predDir](auto prey)
-		{
-			NiPoint3 preyDir = prey->GetPosition() - predPos;
-			if (preyDir.Length() <= 1e-4) {
-				return false;
-			}
-			preyDir = preyDir / preyDir.Length();
-			float cosTheta = predDir.Dot(preyDir);
-			return cosTheta <= 0; // 180 degress
-		}), preys.end());
-
-		// Filter out actors not in a truncated cone
-		// \      x   /
-		//  \  x     /
-		//   \______/  <- Truncated cone
-		//   | pred |  <- Based on width of pred
-		//   |______|
-		float predWidth = 70 * get_visual_scale(pred);
-		float shiftAmount = fabs((predWidth / 2.0f) / tan(BUTTCRUSH_ANGLE/2.0f));
-
-		NiPoint3 coneStart = predPos - predDir * shiftAmount;
-		preys.erase(std::remove_if(preys.begin(), preys.end(),[coneStart, predWidth, predDir](auto prey)
-		{
-			NiPoint3 preyDir = prey->GetPosition() - coneStart;
-			if (preyDir.Length() <= predWidth*0.4f) {
-				return false;
-			}
-			preyDir = preyDir / preyDir.Length();
-			float cosTheta = predDir.Dot(preyDir);
-			return cosTheta <= cos(BUTTCRUSH_ANGLE*PI/180.0f);
-		}), preys.end());
-
 		if (numberOfPrey == 1) {
 			return Vore_GetMaxVoreCount(pred, preys);
 		}
-
-		// Reduce vector size
-		if (preys.size() > numberOfPrey) {
-			preys.resize(numberOfPrey);
-		}
-
 		return preys;
 	}
 
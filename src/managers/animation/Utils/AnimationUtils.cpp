@@ -15,6 +15,7 @@
 #include "managers/perks/PerkHandler.hpp"
 #include "magic/effects/common.hpp"
 #include "utils/MovementForce.hpp"
+#include "utils/SkeletonSnapshot.hpp"
 #include "utils/papyrusUtils.hpp"
 #include "managers/explosion.hpp"
 #include "managers/highheel.hpp"
@@ -812,21 +813,9 @@ namespace Gts {
 					NiPoint3 actorLocation = otherActor->GetPosition();
 					for (auto &point : CrawlPoints) {
 						if ((actorLocation-giantLocation).Length() <= CheckDistance) {
-							int nodeCollisions = 0;
-
-							auto model = otherActor->GetCurrent3D();
-							if (model) {
-								VisitNodes(model, [&nodeCollisions, NodePosition, maxDistance](NiAVObject& a_obj) {
-									float distance = (NodePosition - a_obj.world.translate).Length() - Collision_Distance_Override;
-		
-									if (distance <= maxDistance) {
-										nodeCollisions += 1;
-										return false;
-									}
-									return true;
-								});
-							}
-							if (nodeCollisions > 0 && !otherActor->IsDead()) {
+							auto skeleton = SkeletonSnapshots::Get(otherActor);
+							bool collided = skeleton && skeleton->AnyWithinRadius(NodePosition, maxDistance + Collision_Distance_Override);
+							if (collided && !otherActor->IsDead()) {
 								SetBeingGrinded(otherActor, true);
 								if (Right) {
 									DoFingerGrind(giant, otherActor);
@@ -874,20 +863,15 @@ namespace Gts {
 								int nodeCollisions = 0;
 								float force = 0.0f;
 
-								auto model = otherActor->GetCurrent3D();
+								auto skeleton = SkeletonSnapshots::Get(otherActor);
 
-								if (model) {
+								if (skeleton) {
 									for (auto &point : CoordsToCheck) {
-										VisitNodes(model, [&nodeCollisions, &force, point, maxFootDistance](NiAVObject& a_obj) {
-											float distance = (point - a_obj.world.translate).Length() - Collision_Distance_Override;
-
-											if (distance <= maxFootDistance) {
-												nodeCollisions += 1;
-												force = 1.0f - distance / maxFootDistance;//force += 1.0 - distance / maxFootDistance;
-												return false;
-											}
-											return true;
-										});
+										float distance = 0.0f;
+										if (skeleton->AnyWithinRadius(point, maxFootDistance + Collision_Distance_Override, &distance)) {
+											nodeCollisions += 1;
+											force = 1.0f - (distance - Collision_Distance_Override) / maxFootDistance;
+										}
 									}
 								}
 								if (nodeCollisions > 0) {
@@ -985,18 +969,12 @@ namespace Gts {
 						int nodeCollisions = 0;
 						float force = 0.0f;
 
-						auto model = otherActor->GetCurrent3D();
+						auto skeleton = SkeletonSnapshots::Get(otherActor);
 
-						if (model) {
-							VisitNodes(model, [&nodeCollisions, &force, NodePosition, maxDistance](NiAVObject& a_obj) {
-								float distance = (NodePosition - a_obj.world.translate).Length() - Collision_Distance_Override;
-								if (distance <= maxDistance) {
-									nodeCollisions += 1;
-									force = 1.0f - distance / maxDistance;
-									return false;
-								}
-								return true;
-							});
+						float distance = 0.0f;
+						if (skeleton && skeleton->AnyWithinRadius(NodePosition, maxDistance + Collision_Distance_Override, &distance)) {
+							nodeCollisions += 1;
+							force = 1.0f - (distance - Collision_Distance_Override) / maxDistance;
 						}
 						if (nodeCollisions > 0) {
 							bool allow = IsActionOnCooldown(otherActor, CooldownSource::Damage_Hand);
@@ -1104,19 +1082,15 @@ namespace Gts {
 								int nodeCollisions = 0;
 								float force = 0.0f;
 
-								auto model = otherActor->GetCurrent3D();
+								auto skeleton = SkeletonSnapshots::Get(otherActor);
 								
-								if (model) {
+								if (skeleton) {
 									for (auto &point : ThighPoints) {
-										VisitNodes(model, [&nodeCollisions, &force, point, maxFootDistance](NiAVObject& a_obj) {
-											float distance = (point - a_obj.world.translate).Length() - Collision_Distance_Override;
-											if (distance <= maxFootDistance) {
-												nodeCollisions += 1;
-												force = 1.0f - distance / maxFootDistance;//force += 1.0 - distance / maxFootDistance;
-												return false;
-											}
-											return true;
-										});
+										float distance = 0.0f;
+										if (skeleton->AnyWithinRadius(point, maxFootDistance + Collision_Distance_Override, &distance)) {
+											nodeCollisions += 1;
+											force = 1.0f - (distance - Collision_Distance_Override) / maxFootDistance;
+										}
 									}
 								}
 								if (nodeCollisions > 0) {
@@ -1190,21 +1164,8 @@ namespace Gts {
 					for (auto &point : FingerPoints) {
 						if ((actorLocation-giantLocation).Length() <= CheckDistance) {
 
-							int nodeCollisions = 0;
-
-							auto model = otherActor->GetCurrent3D();
-
-							if (model) {
-								VisitNodes(model, [&nodeCollisions, NodePosition, maxDistance](NiAVObject& a_obj) {
-									float distance = (NodePosition - a_obj.world.translate).Length() - Collision_Distance_Override;
-									if (distance <= maxDistance) {
-										nodeCollisions += 1;
-										return false;
-									}
-									return true;
-								});
-							}
-							if (nodeCollisions > 0) {
+							auto skeleton = SkeletonSnapshots::Get(otherActor);
+							if (skeleton && skeleton->AnyWithinRadius(NodePosition, maxDistance + Collision_Distance_Override)) {
 								if (get_target_scale(otherActor) > 0.08f / GetSizeFromBoundingBox(otherActor)) {
 									update_target_scale(otherActor, Shrink, SizeEffectType::kShrink);
 								} else {
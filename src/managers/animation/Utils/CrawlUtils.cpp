@@ -7,6 +7,8 @@
 #include "managers/GtsSizeManager.hpp"
 #include "managers/CrushManager.hpp"
 #include "utils/MovementForce.hpp"
+#include "utils/ActorGrid.hpp"
+#include "utils/SkeletonSnapshot.hpp"
 #include "managers/audio/footstep.hpp"
 #include "utils/actorUtils.hpp"
 #include "data/persistent.hpp"
@@ -146,38 +148,19 @@ namespace Gts {
 
 		NiPoint3 giantLocation = giant->GetPosition();
 
-		for (auto otherActor: find_actors()) {
+		for (auto otherActor: ActorGrid::FindActorsInRange(giantLocation, CheckDistance)) {
 			if (otherActor != giant) {
 				float tinyScale = get_visual_scale(otherActor);
 				if (giantScale / tinyScale > SCALE_RATIO) {
-					NiPoint3 actorLocation = otherActor->GetPosition();
-					if ((actorLocation-giantLocation).Length() <= CheckDistance) {
-						
-						int nodeCollisions = 0;
-						float force = 0.0f;
-
-						auto model = otherActor->GetCurrent3D();
-
-						if (model) {
-							VisitNodes(model, [&nodeCollisions, &force, NodePosition, maxDistance](NiAVObject& a_obj) {
-								float distance = (NodePosition - a_obj.world.translate).Length() - Collision_Distance_Override;
-								if (distance <= maxDistance) {
-									nodeCollisions += 1;
-									force = 1.0f - distance / maxDistance;
-									return false;
-								}
-								return true;
-							});
-						}
-						if (nodeCollisions > 0) {
-							Utils_PushCheck(giant, otherActor, Get_Bone_Movement_Speed(giant, Cause)); 
-
-							if (IsButtCrushing(giant) && !IsBeingEaten(otherActor) && GetSizeDifference(giant, otherActor, SizeType::VisualScale, false, true) > 1.2f) {
-								PushActorAway(giant, otherActor, 1.0f);
-							}
-							
-							CollisionDamage::GetSingleton().DoSizeDamage(giant, otherActor, damage, bbmult, crushmult, static_cast<int>(random), Cause, true);
+					auto skeleton = SkeletonSnapshots::Get(otherActor);
+					if (skeleton && skeleton->AnyWithinRadius(NodePosition, maxDistance + Collision_Distance_Override)) {
+						Utils_PushCheck(giant, otherActor, Get_Bone_Movement_Speed(giant, Cause)); 
+
+						if (IsButtCrushing(giant) && !IsBeingEaten(otherActor) && GetSizeDifference(giant, otherActor, SizeType::VisualScale, false, true) > 1.2f) {
+							PushActorAway(giant, otherActor, 1.0f);
 						}
+						
+						CollisionDamage::GetSingleton().DoSizeDamage(giant, otherActor, damage, bbmult, crushmult, static_cast<int>(random), Cause, true);
 					}
 				}
 			}
@@ -4,6 +4,7 @@
 #include "data/runtime.hpp"
 #include "scale/scale.hpp"
 #include "UI/DebugAPI.hpp"
+#include "utils/UpdateScheduler.hpp"
 #include "utils/debug.hpp"
 #include "utils/av.hpp"
 #include "profiler.hpp"
@@ -27,7 +28,9 @@ namespace Gts {
 		if (!enable) {
 			return;
 		}
-		for (auto tiny: find_actors()) {
+		// Voices of distant NPCs only need to follow their scale every few frames
+		static const UpdateTaskId task = UpdateScheduler::Register(UpdateTask { .name = "PitchShifter" });
+		UpdateScheduler::Run(task, [](Actor* tiny, std::uint64_t) {
 			if (tiny) {
 				if (tiny->formID != 0x14) {
 					auto ai = tiny->GetActorRuntimeData().currentProcess;
@@ -74,6 +77,6 @@ namespace Gts {
 					}
 				}
 			}
-		}
+		});
 	}
 }
@@ -8,6 +8,8 @@
 #include "ActionSettings.hpp"
 #include "data/runtime.hpp"
 #include "scale/scale.hpp"
+#include "utils/camera.hpp"
+#include "utils/units.hpp"
 #include "profiler.hpp"
 #include "node.hpp"
 
@@ -57,44 +59,147 @@ namespace {
 		return tag;
 	}
 
-	BSSoundHandle get_sound(float movement_mod, NiAVObject* foot, const float& scale, const float& scale_limit, BSISoundDescriptor* sound_descriptor, const VolumeParams& params, const VolumeParams& blend_with, std::string_view tag, float mult, bool blend) {
-		BSSoundHandle result = BSSoundHandle::BSSoundHandle();
-		auto audio_manager = BSAudioManager::GetSingleton();
-		if (foot) {
-			if (sound_descriptor && audio_manager) {
-				float volume = volume_function(scale, params);
-				float frequency = frequency_function(scale, params);
-				float falloff = Sound_GetFallOff(foot, mult);
-				float intensity = volume * falloff * movement_mod;
-				if (scale_limit > 0.02f && scale > scale_limit) {
-					return result; // Return empty sound in that case
+	// Volume/frequency curves are sampled once, scales past the end use the formulas
+	const float CURVE_MAX_SCALE = 128.0f;
+	const std::size_t CURVE_SAMPLES = 1025;
+	// Below this a layer is not played at all (same cut as before)
+	const float MIN_INTENSITY = 0.05f;
+	// Footstep voices started per frame, the quietest ones past this are dropped
+	const std::size_t MAX_VOICES_PER_FRAME = 8;
+
+	class SoundCurve {
+		public:
+			explicit SoundCurve(const VolumeParams& params) : params(params) {
+				for (std::size_t i = 0; i < CURVE_SAMPLES; i++) {
+					float scale = CURVE_MAX_SCALE * static_cast<float>(i) / static_cast<float>(CURVE_SAMPLES - 1);
+					this->volume[i] = this->VolumeAt(scale);
+					this->frequency[i] = frequency_function(scale, params);
 				}
+			}
 
-				intensity = std::clamp(intensity, 0.0f, 1.0f);
-				
-				if (blend) {
-					float exceeded = volume_function(scale, blend_with);
-					if (exceeded > 0.02f) {
-						intensity -= exceeded;
-					}
+			// 0 where volume_function is undefined (scale below params.a)
+			float Volume(float scale) const {
+				if (scale >= CURVE_MAX_SCALE) {
+					return this->VolumeAt(scale);
 				}
+				return Sample(this->volume, scale);
+			}
 
-				if (intensity > 0.05f) {
-
-					// log::trace("  - Playing {} with volume: {}, falloff: {}, intensity: {}", tag, volume, falloff, intensity);
-					audio_manager->BuildSoundDataFromDescriptor(result, sound_descriptor);
-					result.SetVolume(intensity);
-					result.SetFrequency(frequency);
-					NiPoint3 pos;
-					pos.x = 0;
-					pos.y = 0;
-					pos.z = 0;
-					result.SetPosition(pos);
-					result.SetObjectToFollow(foot);
+			float Frequency(float scale) const {
+				if (scale >= CURVE_MAX_SCALE) {
+					return frequency_function(scale, this->params);
 				}
+				return Sample(this->frequency, scale);
 			}
-		}
-		return result;
+
+		private:
+			float VolumeAt(float scale) const {
+				if (scale <= this->params.a) {
+					return 0.0f;
+				}
+				return volume_function(scale, this->params);
+			}
+
+			static float Sample(const std::array<float, CURVE_SAMPLES>& table, float scale) {
+				float position = std::max(scale, 0.0f) / CURVE_MAX_SCALE * static_cast<float>(CURVE_SAMPLES - 1);
+				std::size_t index = std::min(static_cast<std::size_t>(position), CURVE_SAMPLES - 2);
+				float t = position - static_cast<float>(index);
+				return std::lerp(table[index], table[index + 1], t);
+			}
+
+			VolumeParams params;
+			std::array<float, CURVE_SAMPLES> volume;
+			std::array<float, CURVE_SAMPLES> frequency;
+	};
+
+	struct FootstepLayer {
+		std::string_view tag;
+		BSISoundDescriptor* (*descriptor)(const FootEvent& foot_kind);
+		const VolumeParams& params;
+		// Volume of the next layer is taken away from this one so they crossfade
+		const VolumeParams& blend_with;
+		// Layer stops past this scale, limitless if 0
+		float scale_limit;
+		float falloff_mult;
+		bool blend;
+	};
+
+	//https://www.desmos.com/calculator/wh0vwgljfl
+	const std::array<FootstepLayer, 11> LegacyLayers = {{
+		// 271EF4: Sound\fx\GTS\Foot\Effects  (Stone sounds)
+		{"XL: Footstep", get_xlFootstep_sounddesc, xlFootstep_Params, Params_Empty, limit_x14, 1.0f, false},
+		// 16FB25: Sound\fx\GTS\Effects\Footsteps\Original\Rumble (Distant foot sounds)
+		{"XXL Footstep", get_xxlFootstep_sounddesc, xxlFootstep_Params, Params_Empty, limit_x14, 1.0f, false},
+		// These stop to appear at x14
+		// 183F43: Sound\fx\GTS\Effects\Footsteps\Original\Fall
+		{"L Jump", get_lJumpLand_sounddesc, lJumpLand_Params, Params_Empty, limitless, 1.0f, false},
+		// 36A06D: Sound\fx\GTS\Foot\Effects\Rumble1-4.wav
+		{"XL Rumble", get_xlRumble_sounddesc, xlRumble_Params, Params_Empty, limitless, 1.0f, false},
+		//=================================== Custom Commissioned Sounds =========================================
+		{"x2 Footstep", [](const FootEvent& kind) { return get_footstep_highheel(kind, 2); }, Footstep_2_Params, Footstep_4_Params, limit_x4, 1.0f, true},
+		// Stops at x4
+		{"x4 Footstep", [](const FootEvent& kind) { return get_footstep_highheel(kind, 4); }, Footstep_4_Params, Footstep_8_Params, limit_x8, 1.0f, true},
+		// ^ Stops at ~x12
+		{"x8 Footstep", [](const FootEvent& kind) { return get_footstep_highheel(kind, 8); }, Footstep_8_Params, Footstep_12_Params, limit_x14, 1.33f, true},
+		// ^ Stops at ~x14
+		{"x12 Footstep", [](const FootEvent& kind) { return get_footstep_highheel(kind, 12); }, Footstep_12_Params, Footstep_24_Params, limit_x24, 2.0f, true},
+		// ^ Stops at ~x24
+		{"x24 Footstep", [](const FootEvent& kind) { return get_footstep_highheel(kind, 24); }, Footstep_24_Params, Footstep_48_Params, limit_x48, 5.0f, true},
+		// ^ Stops at ~x44
+		{"x48 Footstep", [](const FootEvent& kind) { return get_footstep_highheel(kind, 48); }, Footstep_48_Params, Footstep_96_Params, limit_x96, 8.0f, true},
+		// ^ Stops at ~x88
+		{"x96 Footstep", [](const FootEvent& kind) { return get_footstep_highheel(kind, 96); }, Footstep_96_Params, Params_Empty, limitless, 12.0f, false},
+		// ^ Stops at X126 (when Mega will be added)
+	}};
+
+	// Layers that can be heard in each scale band, built once from the table above
+	//  A layer is silent below its params.a (volume_function has no value there) and above its limit
+	class LayerBands {
+		public:
+			explicit LayerBands(std::span<const FootstepLayer> layers) {
+				for (auto& layer: layers) {
+					this->curves.emplace_back(layer.params);
+					this->blendCurves.emplace_back(layer.blend_with);
+					this->bounds.push_back(layer.params.a);
+					if (layer.scale_limit > 0.02f) {
+						this->bounds.push_back(layer.scale_limit);
+					}
+				}
+				std::sort(this->bounds.begin(), this->bounds.end());
+				this->bounds.erase(std::unique(this->bounds.begin(), this->bounds.end()), this->bounds.end());
+
+				// Band i covers (bounds[i - 1], bounds[i]], the last one is open ended
+				this->bands.resize(this->bounds.size() + 1);
+				for (std::size_t band = 0; band < this->bands.size(); band++) {
+					float low = band == 0 ? -std::numeric_limits<float>::infinity() : this->bounds[band - 1];
+					float high = band < this->bounds.size() ? this->bounds[band] : std::numeric_limits<float>::infinity();
+					for (std::uint8_t i = 0; i < layers.size(); i++) {
+						auto& layer = layers[i];
+						bool started = layer.params.a <= low;
+						bool stopped = layer.scale_limit > 0.02f && layer.scale_limit < high;
+						if (started && !stopped) {
+							this->bands[band].push_back(i);
+						}
+					}
+				}
+			}
+
+			std::span<const std::uint8_t> Audible(float scale) const {
+				auto band = std::lower_bound(this->bounds.begin(), this->bounds.end(), scale) - this->bounds.begin();
+				return this->bands[band];
+			}
+
+			std::vector<SoundCurve> curves;
+			std::vector<SoundCurve> blendCurves;
+
+		private:
+			std::vector<float> bounds;
+			std::vector<std::vector<std::uint8_t>> bands;
+	};
+
+	const LayerBands& GetLegacyBands() {
+		static const LayerBands bands(LegacyLayers);
+		return bands;
 	}
 }
 namespace Gts {
@@ -107,6 +212,64 @@ namespace Gts {
 		return "FootStepManager";
 	}
 
+	void FootStepManager::Update() {
+		std::vector<FootstepVoice> frame;
+		{
+			std::unique_lock lock(this->voiceLock);
+			std::swap(frame, this->voices);
+		}
+		if (frame.empty()) {
+			return;
+		}
+		auto profiler = Profilers::Profile("FootStepSound: Update");
+
+		// Many giants stepping in the same frame: one voice per sound at the loudest foot,
+		// made louder by the others instead of stacking dozens of handles
+		std::sort(frame.begin(), frame.end(), [](const FootstepVoice& a, const FootstepVoice& b) {
+			if (a.descriptor != b.descriptor) {
+				return a.descriptor < b.descriptor;
+			}
+			return a.intensity > b.intensity;
+		});
+		std::vector<FootstepVoice> merged;
+		for (auto& voice: frame) {
+			if (!merged.empty() && merged.back().descriptor == voice.descriptor) {
+				auto& loudest = merged.back();
+				loudest.intensity = std::min(1.0f, 1.0f - (1.0f - loudest.intensity) * (1.0f - voice.intensity));
+			} else {
+				merged.push_back(std::move(voice));
+			}
+		}
+
+		std::size_t count = std::min(merged.size(), MAX_VOICES_PER_FRAME);
+		std::partial_sort(merged.begin(), merged.begin() + count, merged.end(), [](const FootstepVoice& a, const FootstepVoice& b) {
+			return a.intensity > b.intensity;
+		});
+
+		auto audio_manager = BSAudioManager::GetSingleton();
+		if (!audio_manager) {
+			return;
+		}
+		for (std::size_t i = 0; i < count; i++) {
+			auto& voice = merged[i];
+			BSSoundHandle handle = BSSoundHandle();
+			audio_manager->BuildSoundDataFromDescriptor(handle, voice.descriptor);
+			if (handle.soundID == BSSoundHandle::kInvalidID) {
+				continue;
+			}
+			handle.SetVolume(voice.intensity);
+			handle.SetFrequency(voice.frequency);
+			handle.SetPosition(NiPoint3(0.0f, 0.0f, 0.0f));
+			handle.SetObjectToFollow(voice.foot.get());
+			handle.Play();
+		}
+	}
+
+	void FootStepManager::Reset() {
+		std::unique_lock lock(this->voiceLock);
+		this->voices.clear();
+	}
+
 	void FootStepManager::OnImpact(const Impact& impact) {
 		if (impact.actor) {
 			if (!impact.actor->Is3DLoaded()) {
@@ -159,73 +322,51 @@ namespace Gts {
 	void FootStepManager::PlayLegacySounds(float modifier, NiAVObject* foot, FootEvent foot_kind, float scale) {
 		//https://www.desmos.com/calculator/wh0vwgljfl
 		auto profiler = Profilers::Profile("Impact: PlayLegacySounds");
-
-		BSSoundHandle xlFootstep   = get_sound(modifier, foot, scale, limit_x14, get_xlFootstep_sounddesc(foot_kind), xlFootstep_Params, Params_Empty, "XL: Footstep", 1.0f, false);
-		BSSoundHandle xxlFootstep = get_sound(modifier, foot, scale, limit_x14, get_xxlFootstep_sounddesc(foot_kind), xxlFootstep_Params, Params_Empty, "XXL Footstep", 1.0f, false);
-		// These stop to appear at x14
-		BSSoundHandle lJumpLand    = get_sound(modifier, foot, scale, limitless, get_lJumpLand_sounddesc(foot_kind), lJumpLand_Params, Params_Empty, "L Jump", 1.0f, false);
-
-		BSSoundHandle xlRumble     = get_sound(modifier, foot, scale, limitless, get_xlRumble_sounddesc(foot_kind), xlRumble_Params, Params_Empty, "XL Rumble", 1.0f, false);
-		//BSSoundHandle xlSprint     = get_sound(modifier, foot, scale, get_xlSprint_sounddesc(foot_kind),    VolumeParams { .a = start_xl,            .k = 0.50, .n = 0.5, .s = 1.0}, "XL Sprint", 1.0);
-        //  ^ Same normal sounds but a tiny bit louder: 319060: Sound\fx\GTS\Effects\Footsteps\Original\Movement
-		BSSoundHandle Footstep_2   = get_sound(modifier, foot, scale, limit_x4, get_footstep_highheel(foot_kind, 2), Footstep_2_Params, Footstep_4_Params, "x2 Footstep", 1.0f, true);
-		// Stops at x4
-		BSSoundHandle Footstep_4  = get_sound(modifier, foot, scale, limit_x8, get_footstep_highheel(foot_kind, 4), Footstep_4_Params, Footstep_8_Params, "x4 Footstep", 1.0f, true);
-		// ^ Stops at ~x12
-		BSSoundHandle Footstep_8  = get_sound(modifier, foot, scale, limit_x14, get_footstep_highheel(foot_kind, 8), Footstep_8_Params, Footstep_12_Params, "x8 Footstep", 1.33f, true);
-		// ^ Stops at ~x14
-		BSSoundHandle Footstep_12 = get_sound(modifier, foot, scale, limit_x24, get_footstep_highheel(foot_kind, 12), Footstep_12_Params, Footstep_24_Params, "x12 Footstep", 2.0f, true);
-		// ^ Stops at ~x24
-		BSSoundHandle Footstep_24 = get_sound(modifier, foot, scale, limit_x48, get_footstep_highheel(foot_kind, 24), Footstep_24_Params, Footstep_48_Params, "x24 Footstep", 5.0f, true);
-		// ^ Stops at ~x44
-		BSSoundHandle Footstep_48 = get_sound(modifier, foot, scale, limit_x96, get_footstep_highheel(foot_kind, 48), Footstep_48_Params, Footstep_96_Params, "x48 Footstep", 8.0f, true);
-		// ^ Stops at ~x88
-		BSSoundHandle Footstep_96 = get_sound(modifier, foot, scale, limitless, get_footstep_highheel(foot_kind, 96), Footstep_96_Params, Params_Empty, "x96 Footstep", 12.0f, false);
-		// ^ Stops at X126 (when Mega will be added)
-		//BSSoundHandle Footstep_128 = get_sound(modifier, foot, scale, limitless, get_footstep_highheel(foot_kind, 128), Footstep_128_Params, Params_Empty, "Mega Footstep", 18.0f, false);
-
-		if (xlFootstep.soundID != BSSoundHandle::kInvalidID) { 
-			// 271EF4: Sound\fx\GTS\Foot\Effects  (Stone sounds)
-			xlFootstep.Play();
+		if (!foot) {
+			return;
 		}
-		if (xxlFootstep.soundID != BSSoundHandle::kInvalidID) { 
-			// 16FB25: Sound\fx\GTS\Effects\Footsteps\Original\Rumble (Distant foot sounds)
-			xxlFootstep.Play();
+		auto& bands = GetLegacyBands();
+		auto audible = bands.Audible(scale);
+		if (audible.empty()) {
+			return;
 		}
 
-		if (lJumpLand.soundID != BSSoundHandle::kInvalidID) { // Jump Land audio: 
-			// 183F43: Sound\fx\GTS\Effects\Footsteps\Original\Fall
-			lJumpLand.Play();
-		}
-		if (xlRumble.soundID != BSSoundHandle::kInvalidID) { // Rumble when walking at huge scale: 
-			// 36A06D: Sound\fx\GTS\Foot\Effects\Rumble1-4.wav
-			xlRumble.Play();
-		}
+		auto& manager = FootStepManager::GetSingleton();
+		float distance_to_camera = unit_to_meter(get_distance_to_camera(foot));
+		for (auto index: audible) {
+			auto& layer = LegacyLayers[index];
+			BSISoundDescriptor* sound_descriptor = layer.descriptor(foot_kind);
+			if (!sound_descriptor) {
+				continue;
+			}
+			float volume = bands.curves[index].Volume(scale);
+			float falloff = Sound_GetFallOff(distance_to_camera, layer.falloff_mult);
+			float intensity = std::clamp(volume * falloff * modifier, 0.0f, 1.0f);
+
+			if (layer.blend) {
+				float exceeded = bands.blendCurves[index].Volume(scale);
+				if (exceeded > 0.02f) {
+					intensity -= exceeded;
+				}
+			}
 
-		//=================================== Custom Commissioned Sounds =========================================
-		if (Footstep_2.soundID != BSSoundHandle::kInvalidID) { // x1.35 + Custom audio
-			Footstep_2.Play();
-		}
-		if (Footstep_4.soundID != BSSoundHandle::kInvalidID) { // x4 Custom audio
-			Footstep_4.Play();
-		}
-		if (Footstep_8.soundID != BSSoundHandle::kInvalidID) { // x8 Custom audio
-			Footstep_8.Play();
-		}
-		if (Footstep_12.soundID != BSSoundHandle::kInvalidID) { // x12 Custom audio
-			Footstep_12.Play();
-		}
-		if (Footstep_24.soundID != BSSoundHandle::kInvalidID) { // x24 Custom audio
-			Footstep_24.Play();
-		}
-		if (Footstep_48.soundID != BSSoundHandle::kInvalidID) { // x48 Custom audio
-			Footstep_48.Play();
-		}
-		if (Footstep_96.soundID != BSSoundHandle::kInvalidID) { // x96 Custom audio
-			Footstep_96.Play();
+			if (intensity > MIN_INTENSITY) {
+				// log::trace("  - Playing {} with volume: {}, falloff: {}, intensity: {}", layer.tag, volume, falloff, intensity);
+				manager.QueueVoice(FootstepVoice {
+					.descriptor = sound_descriptor,
+					.foot = NiPointer<NiAVObject>(foot),
+					.intensity = intensity,
+					.frequency = bands.curves[index].Frequency(scale),
+				});
+			}
 		}
 	}
 
+	void FootStepManager::QueueVoice(FootstepVoice voice) {
+		std::unique_lock lock(this->voiceLock);
+		this->voices.push_back(std::move(voice));
+	}
+
 	void FootStepManager::PlayHighHeelSounds(float modifier, NiAVObject* foot, FootEvent foot_kind, float scale) {
 		//https://www.desmos.com/calculator/wh0vwgljfl
 		// 2024.04.23: Only 2 sets are done for now: x8, x12 and x24 (still wip)
@@ -9,11 +9,21 @@ using namespace SKSE;
 using namespace RE;
 
 namespace Gts {
+	// A footstep sound layer waiting to be started at the end of the frame
+	struct FootstepVoice {
+		BSISoundDescriptor* descriptor;
+		NiPointer<NiAVObject> foot;
+		float intensity;
+		float frequency;
+	};
+
 	class FootStepManager : public EventListener {
 		public:
 			[[nodiscard]] static FootStepManager& GetSingleton() noexcept;
 
 			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
 			virtual void OnImpact(const Impact& impact) override;
 			static void PlayLegacySounds(float modifier, NiAVObject* foot, FootEvent foot_kind, float scale);
 			static void PlayHighHeelSounds(float modifier, NiAVObject* foot, FootEvent foot_kind, float scale);
@@ -23,5 +33,12 @@ namespace Gts {
 
 			static void PlayVanillaFootstepSounds(Actor* giant, bool right);
 			static void DoStrongSounds(Actor* giant, float animspeed, std::string_view feet);
+
+			// Started in Update under the per frame voice budget
+			void QueueVoice(FootstepVoice voice);
+
+		private:
+			std::mutex voiceLock;
+			std::vector<FootstepVoice> voices;
 	};
 }
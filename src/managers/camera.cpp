@@ -166,15 +166,15 @@ namespace Gts {
 			//offset.z += HighHeelOffset();
 
 			if (currentState->PermitManualEdit()) {
-				this->smoothOffset.target = this->manualEdit;
+				this->smoothOffset.SetTarget(this->manualEdit);
 			}
 
-			offset += this->smoothOffset.value;
-			this->smoothScale.target = scale;
+			offset += this->smoothOffset.GetValue();
+			this->smoothScale.SetTarget(scale);
 
 			// Apply camera scale and offset
 			if (currentState->PermitCameraTransforms()) {
-				UpdateCamera(this->smoothScale.value, offset, playerLocalOffset);
+				UpdateCamera(this->smoothScale.GetValue(), offset, playerLocalOffset);
 			}
 		}
 	}
@@ -1,5 +1,6 @@
 #include "managers/cameras/camutil.hpp"
 #include "managers/GtsSizeManager.hpp"
+#include "managers/cameras/tracking.hpp"
 #include "managers/cameras/state.hpp"
 #include "managers/camera.hpp"
 #include "managers/highheel.hpp"
@@ -24,160 +25,183 @@ namespace {
 
 	const CameraDataMode currentMode = CameraDataMode::State;
 
-	const BoneTarget GetBoneTarget_Anim(CameraTracking Camera_Anim) {
+	const BoneTarget& GetBoneTarget_Anim(CameraTracking Camera_Anim) {
 		switch (Camera_Anim) {
 			case CameraTracking::None: {
-				return BoneTarget();
+				return EmptyTarget();
 			}
 			case CameraTracking::Butt: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Butt","NPC R Butt",},
 					.zoomScale = ZoomIn_butt,
 				};
+				return target;
 			}
 			case CameraTracking::Knees: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Calf [LClf]","NPC R Calf [RClf]",},
 					.zoomScale = ZoomIn_knees,
 				};
+				return target;
 			}
 			case CameraTracking::Breasts_02: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"L Breast02","R Breast02",},
 					.zoomScale = ZoomIn_Breast02,
 				};
+				return target;
 			}
 			case CameraTracking::Thigh_Crush: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC R PreRearCalf","NPC R Foot [Rft ]","NPC L PreRearCalf","NPC L Foot [Lft ]",},
 					.zoomScale = ZoomIn_ThighCrush,
 				};
+				return target;
 			}
 			case CameraTracking::Thigh_Sandwich: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"AnimObjectA",},
 					.zoomScale = ZoomIn_ThighSandwich,
 				};
+				return target;
 			}
 			case CameraTracking::Hand_Right: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC R Hand [RHnd]",},
 					.zoomScale = ZoomIn_RightHand,
 				};
+				return target;
 			}
 			case CameraTracking::Hand_Left: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Hand [LHnd]",},
 					.zoomScale = ZoomIn_LeftHand,
 				};
+				return target;
 			}
 			case CameraTracking::Grab_Left: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Finger02 [LF02]",},
 					.zoomScale = ZoomIn_GrabLeft,
 				};
+				return target;
 			}
 			case CameraTracking::L_Foot: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Foot [Lft ]",},
 					.zoomScale = ZoomIn_LeftFoot,
 				};
+				return target;
 			}
 			case CameraTracking::R_Foot: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC R Foot [Rft ]",},
 					.zoomScale = ZoomIn_RightFoot,
 				};
+				return target;
 			}
 			case CameraTracking::Mid_Butt_Legs: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Butt","NPC R Butt","NPC L Foot [Lft ]","NPC R Foot [Rft ]",},
 					.zoomScale = ZoomIn_ButtLegs,
 				};
+				return target;
 			}
 			case CameraTracking::VoreHand_Right: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"AnimObjectA",},
 					.zoomScale = ZoomIn_VoreRight,
 				};
+				return target;
 			}
 			case CameraTracking::Finger_Right: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC R Finger12 [RF12]",},
 					.zoomScale = ZoomIn_FingerRight,
 				};
+				return target;
 			}
 			case CameraTracking::Finger_Left: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Finger12 [LF12]",},
 					.zoomScale = ZoomIn_FingerLeft,
 				};
+				return target;
 			}
 			case CameraTracking::ObjectA: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"AnimObjectA",},
 					.zoomScale = ZoomIn_ObjectA,
 				};
+				return target;
 			}
 			case CameraTracking::ObjectB: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"AnimObjectB",},
 					.zoomScale = ZoomIn_ObjectB,
 				};
+				return target;
 			}
 		}
-		return BoneTarget();
+		return EmptyTarget();
 	}
 
-	const BoneTarget GetBoneTarget_MCM(CameraTracking_MCM Camera_MCM) {
+	const BoneTarget& GetBoneTarget_MCM(CameraTracking_MCM Camera_MCM) {
 		switch (Camera_MCM) {
 			case CameraTracking_MCM::None: {
-				return BoneTarget();
+				return EmptyTarget();
 			}
 			case CameraTracking_MCM::Spine: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC Spine2 [Spn2]","NPC Neck [Neck]",},
 					.zoomScale = ZoomIn_Cam_Spine,
 				};
+				return target;
 			}
 			case CameraTracking_MCM::Clavicle: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC R Clavicle [RClv]","NPC L Clavicle [LClv]",},
 					.zoomScale = ZoomIn_Cam_Clavicle,
 				};
+				return target;
 			}
 			case CameraTracking_MCM::Breasts_01: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Breast","NPC R Breast",},
 					.zoomScale = ZoomIn_Cam_Breasts_01,
 				};
+				return target;
 			}
 			case CameraTracking_MCM::Breasts_02: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"L Breast02","R Breast02",},
 					.zoomScale = ZoomIn_Cam_Breasts_02,
 				};
+				return target;
 			}
 			case CameraTracking_MCM::Breasts_03: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"L Breast03","R Breast03",},
 					.zoomScale = ZoomIn_Cam_Breasts_03,
 				};
+				return target;
 			}
 			case CameraTracking_MCM::Neck: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC Neck [Neck]",},
 					.zoomScale = ZoomIn_Cam_Neck,
 				};
+				return target;
 			}
 			case CameraTracking_MCM::Butt: {
-				return BoneTarget {
+				static const BoneTarget target {
 					.boneNames = {"NPC L Butt","NPC R Butt",},
 					.zoomScale = ZoomIn_Cam_Butt,
 				};
+				return target;
 			}
 		}
-		return BoneTarget();
+		return EmptyTarget();
 	}
 
 	NiPoint3 CameraStateToCoords(Actor* giant) {
@@ -185,23 +209,18 @@ namespace {
 		NiPoint3 result = NiPoint3();
 		switch (cameraMode) {
 			case 3: // Between Foot
-				for (auto Foot: {"NPC L Foot [Lft ]", "NPC R Foot [Rft ]"}) {
-					auto node = find_node(giant, Foot);
-					if (Foot) {
-						result += node->world.translate / 2;
-					}
+				for (auto node: BoneTracker::Resolve(giant, BothFeetTarget())) {
+					result += node->world.translate / 2;
 				}
 			break; 
 			case 4: { // Left Foot
-				auto node = find_node(giant, "NPC L Foot [Lft ]");
-				if (node) {
+				for (auto node: BoneTracker::Resolve(giant, LeftFootTarget())) {
 					result = node->world.translate;
 				}
 			}
 			break;
 			case 5: { // Right Foot
-				auto node = find_node(giant, "NPC R Foot [Rft ]");
-				if (node) {
+				for (auto node: BoneTracker::Resolve(giant, RightFootTarget())) {
 					result = node->world.translate;
 				}
 			break;
@@ -218,26 +237,17 @@ namespace {
 		CameraTracking_MCM Camera_MCM = static_cast<CameraTracking_MCM>(MCM_Mode);
 		CameraTracking Camera_Anim = sizemanager.GetTrackedBone(player);
 
-		BoneTarget targets = BoneTarget();
-
 		NiPoint3 FootPos = CameraStateToCoords(giant);
 		
 		if (FootPos.Length() > 0.0f) {
 			point = FootPos;
 			// Just update foot coords
 		} else {
-			if (Camera_Anim != CameraTracking::None) {
-				targets = GetBoneTarget_Anim(Camera_Anim);
-			} else {
-				targets = GetBoneTarget_MCM(Camera_MCM);
-			}
+			const BoneTarget& targets = (Camera_Anim != CameraTracking::None) ? GetBoneTarget_Anim(Camera_Anim) : GetBoneTarget_MCM(Camera_MCM);
 
 			if (!targets.boneNames.empty()) {
-				for (auto node_name: targets.boneNames) {
-					auto node = find_node_any(giant, node_name);
-					if (node) {
-						point += node->world.translate / targets.boneNames.size();
-					}
+				for (auto node: BoneTracker::Resolve(giant, targets, true)) {
+					point += node->world.translate / targets.boneNames.size();
 				}
 			}
 		}
@@ -263,9 +273,9 @@ namespace {
 
 namespace Gts {
 
-	BoneTarget GetBoneTargets(CameraTracking Camera_Anim, CameraTracking_MCM Camera_MCM) {
+	const BoneTarget& GetBoneTargets(CameraTracking Camera_Anim, CameraTracking_MCM Camera_MCM) {
 		if (HasFirstPersonBody()) {
-			return BoneTarget();
+			return EmptyTarget();
 		}
 		if (Camera_Anim != CameraTracking::None) { // must take priority
 			return GetBoneTarget_Anim(Camera_Anim);
@@ -642,8 +652,9 @@ namespace Gts {
 							//This method relies on the camera having a target as we cast from the target to the camera
 							//upside this only needs 1 raycast, downside you need to have a target
 
-							if (auto node = find_node_any(cameraActor, "NPC Pelvis [Pelv]")) {
-								auto rayStart = node->world.translate;
+							auto pelvis = BoneTracker::Resolve(cameraActor, PelvisTarget(), true);
+							if (!pelvis.empty()) {
+								auto rayStart = pelvis.front()->world.translate;
 
 								//ReadBoneTargets(cameraActor, rayStart);
 
@@ -5,7 +5,8 @@
 using namespace RE;
 
 namespace Gts {
-	BoneTarget GetBoneTargets(CameraTracking Camera_Anim, CameraTracking_MCM Camera_MCM);
+	// Static, the same target is returned every time so its nodes stay cached in BoneTracker
+	const BoneTarget& GetBoneTargets(CameraTracking Camera_Anim, CameraTracking_MCM Camera_MCM);
 
 	float HighHeelOffset();
 
@@ -45,7 +45,7 @@ namespace Gts {
 		Alt::ZOffset = Offset - (0.15f * Gts::MaxZoom());
 	}
 
-	BoneTarget Alt::GetBoneTarget() {
+	const BoneTarget& Alt::GetBoneTarget() {
 		auto player = PlayerCharacter::GetSingleton();
 		auto& sizemanager = SizeManager::GetSingleton();
 
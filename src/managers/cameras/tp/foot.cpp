@@ -1,4 +1,5 @@
 #include "managers/cameras/tp/foot.hpp"
+#include "managers/cameras/tracking.hpp"
 #include "managers/cameras/camutil.hpp"
 #include "managers/highheel.hpp"
 #include "ActionSettings.hpp"
@@ -18,9 +19,9 @@ namespace Gts {
 		if (player) {
 			float playerScale = get_visual_scale(player);
 			if (playerScale > 0.0f) {
-				this->smoothScale.value = playerScale;
-				this->smoothScale.target = playerScale;
-				this->smoothScale.velocity = 0.0f;
+				this->smoothScale.SetValue(playerScale);
+				this->smoothScale.SetTarget(playerScale);
+				this->smoothScale.SetVelocity(0.0f);
 			}
 		}
 	}
@@ -40,8 +41,8 @@ namespace Gts {
 				playerTrans.scale = rootModel->parent ? rootModel->parent->world.scale : 1.0f;  // Only do translation/rotation
 				auto transform = playerTrans.Invert();
 				NiPoint3 localLookAt = transform*lookAt;
-				this->smoothScale.target = playerScale;
-				return localLookAt * -1 * this->smoothScale.value + footPos;
+				this->smoothScale.SetTarget(playerScale);
+				return localLookAt * -1 * this->smoothScale.GetValue() + footPos;
 			}
 		}
 		return NiPoint3();
@@ -52,8 +53,6 @@ namespace Gts {
 	}
 
 	NiPoint3 Foot::GetFootPos() {
-		const std::string_view leftFootLookup = "NPC L Foot [Lft ]";
-		const std::string_view rightFootLookup = "NPC R Foot [Rft ]";
 		auto player = GetCameraActor();
 		if (player) {
 			float playerScale = get_visual_scale(player);
@@ -62,17 +61,19 @@ namespace Gts {
 				auto playerTrans = rootModel->world;
 				playerTrans.scale = rootModel->parent ? rootModel->parent->world.scale : 1.0f;  // Only do translation/rotation
 				auto transform = playerTrans.Invert();
-				auto leftFoot = find_node(player, leftFootLookup);
-				auto rightFoot = find_node(player, rightFootLookup);
-				if (leftFoot && rightFoot) {
+				auto feet = BoneTracker::Resolve(player, BothFeetTarget());
+				if (feet.size() == 2) {
+					auto leftFoot = feet[0];
+					auto rightFoot = feet[1];
 					auto leftPosLocal = transform * (leftFoot->world * NiPoint3());
 					auto rightPosLocal = transform * (rightFoot->world * NiPoint3());
-					this->smoothFootPos.target = (leftPosLocal + rightPosLocal) / 2.0f;
+					NiPoint3 footTarget = (leftPosLocal + rightPosLocal) / 2.0f;
 
-					this->smoothFootPos.target.z += OFFSET*playerScale;
+					footTarget.z += OFFSET*playerScale;
+					this->smoothFootPos.SetTarget(footTarget);
 				}
 			}
 		}
-		return this->smoothFootPos.value;
+		return this->smoothFootPos.GetValue();
 	}
 }
@@ -1,4 +1,5 @@
 #include "managers/cameras/tp/footL.hpp"
+#include "managers/cameras/tracking.hpp"
 #include "managers/cameras/camutil.hpp"
 #include "managers/highheel.hpp"
 #include "data/runtime.hpp"
@@ -13,7 +14,6 @@ namespace {
 
 namespace Gts {
 	NiPoint3 FootL::GetFootPos() {
-		const std::string_view leftFootLookup = "NPC L Foot [Lft ]";
 		auto player = GetCameraActor();
 		if (player) {
 			auto rootModel = player->Get3D(false);
@@ -21,16 +21,18 @@ namespace Gts {
 				auto playerTrans = rootModel->world;
 				playerTrans.scale = rootModel->parent ? rootModel->parent->world.scale : 1.0f;  // Only do translation/rotation
 				auto transform = playerTrans.Invert();
-				auto leftFoot = find_node(player, leftFootLookup);
-				if (leftFoot) {
+				auto foot = BoneTracker::Resolve(player, LeftFootTarget());
+				if (!foot.empty()) {
+					auto leftFoot = foot.front();
 					float playerScale = get_visual_scale(player);
 					auto leftPosLocal = transform * (leftFoot->world * NiPoint3());
-					this->smoothFootPos.target = leftPosLocal;
+					NiPoint3 footTarget = leftPosLocal;
 
-					this->smoothFootPos.target.z += OFFSET*playerScale;
+					footTarget.z += OFFSET*playerScale;
+					this->smoothFootPos.SetTarget(footTarget);
 				}
 			}
 		}
-		return this->smoothFootPos.value;
+		return this->smoothFootPos.GetValue();
 	}
 }
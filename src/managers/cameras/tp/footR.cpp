@@ -1,4 +1,5 @@
 #include "managers/cameras/tp/footR.hpp"
+#include "managers/cameras/tracking.hpp"
 #include "managers/cameras/camutil.hpp"
 #include "managers/highheel.hpp"
 #include "data/runtime.hpp"
@@ -13,7 +14,6 @@ namespace {
 
 namespace Gts {
 	NiPoint3 FootR::GetFootPos() {
-		const std::string_view rightFootLookup = "NPC R Foot [Rft ]";
 		auto player = GetCameraActor();
 		if (player) {
 			auto rootModel = player->Get3D(false);
@@ -21,16 +21,18 @@ namespace Gts {
 				auto playerTrans = rootModel->world;
 				playerTrans.scale = rootModel->parent ? rootModel->parent->world.scale : 1.0f;  // Only do translation/rotation
 				auto transform = playerTrans.Invert();
-				auto rightFoot = find_node(player, rightFootLookup);
-				if (rightFoot) {
+				auto foot = BoneTracker::Resolve(player, RightFootTarget());
+				if (!foot.empty()) {
+					auto rightFoot = foot.front();
 					float playerScale = get_visual_scale(player);
 					auto rightPosLocal = transform * (rightFoot->world * NiPoint3());
-					this->smoothFootPos.target = rightPosLocal;
+					NiPoint3 footTarget = rightPosLocal;
 
-					this->smoothFootPos.target.z += OFFSET*playerScale;
+					footTarget.z += OFFSET*playerScale;
+					this->smoothFootPos.SetTarget(footTarget);
 				}
 			}
 		}
-		return this->smoothFootPos.value;
+		return this->smoothFootPos.GetValue();
 	}
 }
@@ -44,7 +44,7 @@ namespace Gts {
 		Normal::ZOffset = Offset - (0.15f * Gts::MaxZoom());
 	}
 
-	BoneTarget Normal::GetBoneTarget() {
+	const BoneTarget& Normal::GetBoneTarget() {
 		auto player = PlayerCharacter::GetSingleton();
 		auto& sizemanager = SizeManager::GetSingleton();
 
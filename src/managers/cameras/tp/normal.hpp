@@ -18,6 +18,6 @@ namespace Gts {
 
 			virtual NiPoint3 GetCombatOffsetProne(const NiPoint3& cameraPos) override;
 
-			virtual BoneTarget GetBoneTarget() override;
+			virtual const BoneTarget& GetBoneTarget() override;
 	};
 }
@@ -1,5 +1,5 @@
 #include "managers/cameras/tpState.hpp"
-#include "managers/cameras/camutil.hpp"
+#include "managers/cameras/tracking.hpp"
 #include "managers/cameras/camutil.hpp"
 #include "managers/animation/Grab.hpp"
 #include "managers/GtsSizeManager.hpp"
@@ -28,7 +28,7 @@ namespace Gts {
 		auto player = GetCameraActor();
 		if (player) {
 			auto scale = get_visual_scale(player);
-			auto boneTarget = this->GetBoneTarget();
+			const auto& boneTarget = this->GetBoneTarget();
 			if (!boneTarget.boneNames.empty()) {
 				auto player = GetCameraActor();
 				if (player) {
@@ -39,20 +39,12 @@ namespace Gts {
 						auto transform = playerTrans.Invert();
 						NiPoint3 lookAt = CompuleLookAt(boneTarget.zoomScale);
 						NiPoint3 localLookAt = transform*lookAt;
-						this->smoothScale.halflife = Modify_HalfLife();
-						this->smoothedBonePos.halflife = Modify_HalfLife();
-						this->smoothScale.target = scale;
-						pos += localLookAt * -1 * this->smoothScale.value;
+						this->smoothScale.SetHalfLife(Modify_HalfLife());
+						this->smoothedBonePos.SetHalfLife(Modify_HalfLife());
+						this->smoothScale.SetTarget(scale);
+						pos += localLookAt * -1 * this->smoothScale.GetValue();
 
-						std::vector<NiAVObject*> bones = {};
-						for (auto bone_name: boneTarget.boneNames) {
-							auto node = find_node(player, bone_name);
-							if (node) {
-								bones.push_back(node);
-							} else {
-								log::error("Bone not found for camera target: {}", bone_name);
-							}
-						}
+						auto bones = BoneTracker::Resolve(player, boneTarget);
 
 						NiPoint3 bonePos = NiPoint3();
 						auto bone_count = bones.size();
@@ -68,8 +60,8 @@ namespace Gts {
 						if (IsDebugEnabled()) {
 							DebugAPI::DrawSphere(glm::vec3(worldBonePos.x, worldBonePos.y, worldBonePos.z), 1.0f, 10, {0.0f, 1.0f, 0.0f, 1.0f});
 						}
-						smoothedBonePos.target = bonePos;
-						pos += smoothedBonePos.value;
+						smoothedBonePos.SetTarget(bonePos);
+						pos += smoothedBonePos.GetValue();
 					}
 				}
 			}
@@ -87,8 +79,8 @@ namespace Gts {
 		return pos;
 	}
 
-	BoneTarget ThirdPersonCameraState::GetBoneTarget() {
-		return BoneTarget();
+	const BoneTarget& ThirdPersonCameraState::GetBoneTarget() {
+		return EmptyTarget();
 	}
 
 	NiPoint3 ThirdPersonCameraState::ProneAdjustment(const NiPoint3& cameraPos) {
@@ -9,7 +9,7 @@ namespace Gts {
 		public:
 			virtual NiPoint3 GetPlayerLocalOffset(const NiPoint3& cameraPos) override;
 			virtual NiPoint3 GetPlayerLocalOffsetProne(const NiPoint3& cameraPos) override;
-			virtual BoneTarget GetBoneTarget();
+			virtual const BoneTarget& GetBoneTarget();
 			virtual NiPoint3 ProneAdjustment(const NiPoint3& cameraPosLocal);
 
 		private:
@@ -0,0 +1,160 @@
+#include "managers/cameras/tracking.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+#include "node.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	// Bones like AnimObjectA only exist while an animation uses them
+	const double MISS_RETRY_TIME = 0.25;
+	// A handful of targets per camera actor, anything above is left over from old actors
+	const std::size_t MAX_ENTRIES = 64;
+	const std::size_t MAX_DEPTH = 256;
+
+	bool IsAttached(NiAVObject* node, NiAVObject* root) {
+		std::size_t depth = 0;
+		while (node && depth < MAX_DEPTH) {
+			if (node == root) {
+				return true;
+			}
+			node = node->parent;
+			depth += 1;
+		}
+		return false;
+	}
+}
+
+namespace Gts {
+	const BoneTarget& EmptyTarget() {
+		static const BoneTarget target;
+		return target;
+	}
+
+	const BoneTarget& PelvisTarget() {
+		static const BoneTarget target {
+			.boneNames = {"NPC Pelvis [Pelv]",},
+		};
+		return target;
+	}
+
+	const BoneTarget& LeftFootTarget() {
+		static const BoneTarget target {
+			.boneNames = {"NPC L Foot [Lft ]",},
+		};
+		return target;
+	}
+
+	const BoneTarget& RightFootTarget() {
+		static const BoneTarget target {
+			.boneNames = {"NPC R Foot [Rft ]",},
+		};
+		return target;
+	}
+
+	const BoneTarget& BothFeetTarget() {
+		static const BoneTarget target {
+			.boneNames = {"NPC L Foot [Lft ]","NPC R Foot [Rft ]",},
+		};
+		return target;
+	}
+
+	BoneTracker& BoneTracker::GetSingleton() noexcept {
+		static BoneTracker instance;
+		return instance;
+	}
+
+	std::string BoneTracker::DebugName() {
+		return "BoneTracker";
+	}
+
+	void BoneTracker::Reset() {
+		this->entries.clear();
+	}
+
+	void BoneTracker::ResetActor(Actor* actor) {
+		this->Invalidate(actor);
+	}
+
+	void BoneTracker::ActorEquip(Actor* actor) {
+		this->Invalidate(actor);
+	}
+
+	void BoneTracker::ActorLoaded(Actor* actor) {
+		this->Invalidate(actor);
+	}
+
+	std::span<NiAVObject* const> BoneTracker::Resolve(Actor* actor, const BoneTarget& target, bool anyPerson) {
+		if (!actor || target.boneNames.empty() || !actor->Is3DLoaded()) {
+			return {};
+		}
+		auto& me = BoneTracker::GetSingleton();
+		for (auto& entry: me.entries) {
+			if (entry.target == &target && entry.actor == actor->formID && entry.anyPerson == anyPerson) {
+				if (!me.IsValid(entry, actor)) {
+					me.Rebuild(entry, actor);
+				}
+				return entry.nodes;
+			}
+		}
+
+		if (me.entries.size() >= MAX_ENTRIES) {
+			me.entries.clear();
+		}
+		auto& entry = me.entries.emplace_back();
+		entry.target = &target;
+		entry.actor = actor->formID;
+		entry.anyPerson = anyPerson;
+		me.Rebuild(entry, actor);
+		return entry.nodes;
+	}
+
+	bool BoneTracker::IsValid(const Entry& entry, Actor* actor) const {
+		NiAVObject* thirdPerson = actor->Get3D(false);
+		NiAVObject* firstPerson = entry.anyPerson ? actor->Get3D(true) : nullptr;
+		if (entry.thirdPerson != thirdPerson || entry.firstPerson != firstPerson) {
+			return false;
+		}
+		if (entry.nodes.size() < entry.target->boneNames.size() && Time::WorldTimeElapsed() - entry.resolvedTime > MISS_RETRY_TIME) {
+			return false;
+		}
+		for (auto node: entry.nodes) {
+			// Anim objects and armor nodes get detached without a 3D change
+			if (!IsAttached(node, thirdPerson) && !IsAttached(node, firstPerson)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void BoneTracker::Rebuild(Entry& entry, Actor* actor) {
+		auto profiler = Profilers::Profile("BoneTracker: Rebuild");
+		entry.thirdPerson = actor->Get3D(false);
+		entry.firstPerson = entry.anyPerson ? actor->Get3D(true) : nullptr;
+		entry.resolvedTime = Time::WorldTimeElapsed();
+		entry.references.clear();
+		entry.nodes.clear();
+		for (auto& name: entry.target->boneNames) {
+			auto node = entry.anyPerson ? find_node_any(actor, name) : find_node(actor, name);
+			if (node) {
+				entry.references.emplace_back(node);
+				entry.nodes.push_back(node);
+			} else {
+				log::error("Bone not found for camera target: {}", name);
+			}
+		}
+	}
+
+	void BoneTracker::Invalidate(Actor* actor) {
+		if (!actor) {
+			return;
+		}
+		FormID id = actor->formID;
+		std::erase_if(this->entries, [id](const Entry& entry) {
+			return entry.actor == id;
+		});
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+// Module that resolves camera bone targets to nodes
+//  The nodes of a target are looked up once when the target, the actor or its 3D changes,
+//  the camera update only reads their world transforms after that
+#include "events.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+
+	// Fixed targets of the foot cameras and the camera collision
+	const BoneTarget& EmptyTarget();
+	const BoneTarget& PelvisTarget();
+	const BoneTarget& LeftFootTarget();
+	const BoneTarget& RightFootTarget();
+	const BoneTarget& BothFeetTarget();
+
+	class BoneTracker : public EventListener {
+		public:
+			[[nodiscard]] static BoneTracker& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+			virtual void ActorEquip(Actor* actor) override;
+			virtual void ActorLoaded(Actor* actor) override;
+
+			// Nodes of the target on the actor in bone name order, missing bones are left out
+			// The span is only valid until the next call
+			// The target must outlive the cache (the ones from GetBoneTargets and above are static)
+			// anyPerson falls back to the first person skeleton like find_node_any
+			static std::span<NiAVObject* const> Resolve(Actor* actor, const BoneTarget& target, bool anyPerson = false);
+
+		private:
+			struct Entry {
+				const BoneTarget* target = nullptr;
+				FormID actor = 0;
+				bool anyPerson = false;
+				// Roots the nodes were resolved from
+				NiAVObject* thirdPerson = nullptr;
+				NiAVObject* firstPerson = nullptr;
+				double resolvedTime = 0.0;
+				// The references keep the raw pointers below alive until they are checked
+				std::vector<NiPointer<NiAVObject>> references;
+				std::vector<NiAVObject*> nodes;
+			};
+
+			bool IsValid(const Entry& entry, Actor* actor) const;
+			void Rebuild(Entry& entry, Actor* actor);
+			void Invalidate(Actor* actor);
+
+			std::vector<Entry> entries;
+	};
+}
@@ -12,6 +12,8 @@
 #include "managers/InputManager.hpp"
 #include "magic/effects/common.hpp"
 #include "utils/MovementForce.hpp"
+#include "utils/ActorGrid.hpp"
+#include "utils/SkeletonSnapshot.hpp"
 #include "managers/GtsManager.hpp"
 #include "managers/Attributes.hpp"
 #include "managers/hitmanager.hpp"
@@ -214,51 +216,40 @@ namespace Gts {
 				}
 
 				NiPoint3 giantLocation = actor->GetPosition();
-				for (auto otherActor: find_actors()) {
+				for (auto entry: ActorGrid::Query(giantLocation, BASE_CHECK_DISTANCE*giantScale)) {
+					Actor* otherActor = entry->actor;
 					if (otherActor != actor) {
-						float tinyScale = get_visual_scale(otherActor) * GetSizeFromBoundingBox(otherActor);
+						float tinyScale = entry->scale;
 						if (giantScale / tinyScale > SCALE_RATIO) {
-							NiPoint3 actorLocation = otherActor->GetPosition();
-
-							if ((actorLocation-giantLocation).Length() < BASE_CHECK_DISTANCE*giantScale) {
-								// Check the tiny's nodes against the giant's foot points
-								int nodeCollisions = 0;
-								bool DoDamage = true;
-
-								auto model = otherActor->GetCurrent3D();
-								
-								if (model) {
-									bool StopDamageLookup = false;
-									for (auto point: CoordsToCheck) {
-										if (!StopDamageLookup) {
-											VisitNodes(model, [&nodeCollisions, &Calamity, &DoDamage, SMT, point, maxFootDistance, &StopDamageLookup](NiAVObject& a_obj) {
-												float distance = (point - a_obj.world.translate).Length() - Collision_Distance_Override;
-												if (distance <= maxFootDistance) {
-													StopDamageLookup = true;
-													nodeCollisions += 1;
-													return false;
-												}
-												return true;
-											});
-										}
-									}
-									if (SupportCalamity && SMT) { // Seek for actors to shrink during Tiny Calamity
-										TinyCalamity_SeekForShrink(actor, otherActor, damage, maxFootDistance * Calamity, Cause, Right, ApplyCooldown, ignore_rotation);
+							// Check the tiny's nodes against the giant's foot points
+							int nodeCollisions = 0;
+							bool DoDamage = true;
+
+							auto skeleton = SkeletonSnapshots::Get(otherActor);
+							
+							if (skeleton) {
+								for (auto point: CoordsToCheck) {
+									if (skeleton->AnyWithinRadius(point, maxFootDistance + Collision_Distance_Override)) {
+										nodeCollisions += 1;
+										break;
 									}
 								}
-								if (nodeCollisions > 0) {
-									if (ApplyCooldown) { // Needed to fix Thigh Crush stuff
-										auto& sizemanager = SizeManager::GetSingleton();
-										bool OnCooldown = IsActionOnCooldown(otherActor, CooldownSource::Damage_Thigh);
-										if (!OnCooldown) {
-											Utils_PushCheck(actor, otherActor, Get_Bone_Movement_Speed(actor, Cause)); // pass original un-altered force
-											CollisionDamage.DoSizeDamage(actor, otherActor, damage, bbmult, crush_threshold, random, Cause, DoDamage);
-											ApplyActionCooldown(otherActor, CooldownSource::Damage_Thigh);
-										}
-									} else {
+								if (SupportCalamity && SMT) { // Seek for actors to shrink during Tiny Calamity
+									TinyCalamity_SeekForShrink(actor, otherActor, damage, maxFootDistance * Calamity, Cause, Right, ApplyCooldown, ignore_rotation);
+								}
+							}
+							if (nodeCollisions > 0) {
+								if (ApplyCooldown) { // Needed to fix Thigh Crush stuff
+									auto& sizemanager = SizeManager::GetSingleton();
+									bool OnCooldown = IsActionOnCooldown(otherActor, CooldownSource::Damage_Thigh);
+									if (!OnCooldown) {
 										Utils_PushCheck(actor, otherActor, Get_Bone_Movement_Speed(actor, Cause)); // pass original un-altered force
 										CollisionDamage.DoSizeDamage(actor, otherActor, damage, bbmult, crush_threshold, random, Cause, DoDamage);
+										ApplyActionCooldown(otherActor, CooldownSource::Damage_Thigh);
 									}
+								} else {
+									Utils_PushCheck(actor, otherActor, Get_Bone_Movement_Speed(actor, Cause)); // pass original un-altered force
+									CollisionDamage.DoSizeDamage(actor, otherActor, damage, bbmult, crush_threshold, random, Cause, DoDamage);
 								}
 							}
 						}
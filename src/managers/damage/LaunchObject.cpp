@@ -14,6 +14,7 @@
 #include "managers/hitmanager.hpp"
 #include "managers/highheel.hpp"
 #include "utils/actorUtils.hpp"
+#include "utils/ObjectGrid.hpp"
 #include "data/persistent.hpp"
 #include "ActionSettings.hpp"
 #include "data/transient.hpp"
@@ -87,6 +88,7 @@ namespace {
 					push *= Multiply_By_Mass(body);
 					//log::info("Applying force to object, Push: {}, Force: {}, Result: {}", Vector2Str(push), force, Vector2Str(push * force));
 					SetLinearImpulse(body, hkVector4(push.x * force, push.y * force, push.z * force, 1.0f));
+					ObjectGrid::Wake(object);
 				}
 			}
 		}
@@ -187,6 +189,7 @@ namespace Gts {
 										if (body) {
 											push *= Multiply_By_Mass(body);
 											SetLinearImpulse(body, hkVector4(0, 0, push, push));
+											ObjectGrid::Wake(objectref);
 										}
 									}
 								}
@@ -308,43 +311,10 @@ namespace Gts {
 		if (!PreciseScan) { // Scan single cell only
 			TESObjectCELL* cell = giant->GetParentCell();
 			if (cell) {
-				auto data = cell->GetRuntimeData();
-				for (auto object: data.references) {
-					if (object) {
-						auto objectref = object.get();
-						if (objectref) {
-							bool IsActor = objectref->Is(FormType::ActorCharacter);
-							if (!IsActor) { // we don't want to apply it to actors
-								NiPoint3 objectlocation = objectref->GetPosition();
-								float distance = (point - objectlocation).Length();
-								if (distance <= maxDistance) {
-									ObjectRefHandle refhandle = objectref->CreateRefHandle(); 
-									Objects.push_back(refhandle);
-								}
-							}
-						}
-					}
-				}
-			}
-		} else if (PreciseScan) { // Else scan Entire world
-			TESObjectREFR* GiantRef = skyrim_cast<TESObjectREFR*>(giant);
-			if (GiantRef) {
-				//Revert to hack....
-				ForEachReferenceInRange_Custom(GiantRef, maxDistance, [&](RE::TESObjectREFR& a_ref) {
-					bool IsActor = a_ref.Is(FormType::ActorCharacter);
-					if (!IsActor) { // we don't want to apply it to actors
-						NiPoint3 objectlocation = a_ref.GetPosition();
-						float distance = (point - objectlocation).Length();
-						if (distance <= maxDistance) {
-							ObjectRefHandle handle = a_ref.CreateRefHandle();
-							if (handle) {
-								Objects.push_back(handle);
-							}
-						}
-					}
-					return RE::BSContainer::ForEachResult::kContinue;    
-				});
+				Objects = ObjectGrid::Query(point, maxDistance, cell);
 			}
+		} else { // Else scan every attached cell
+			Objects = ObjectGrid::Query(point, maxDistance);
 		}
 		
 		return Objects;
@@ -10,6 +10,8 @@
 #include "magic/effects/common.hpp"
 #include "managers/Attributes.hpp"
 #include "utils/MovementForce.hpp"
+#include "utils/ActorGrid.hpp"
+#include "utils/SkeletonSnapshot.hpp"
 #include "managers/highheel.hpp"
 #include "utils/actorUtils.hpp"
 #include "data/persistent.hpp"
@@ -187,20 +189,11 @@ namespace Gts {
     void TinyCalamity_SeekForShrink(Actor* giant, Actor* tiny, float damage, float maxFootDistance, DamageSource Cause, bool Right, bool ApplyCooldown, bool ignore_rotation) {
         std::vector<NiPoint3> CoordsToCheck = GetFootCoordinates(giant, Right, ignore_rotation);
         int nodeCollisions = 0;
-        auto model = tiny->GetCurrent3D();
-        if (model) {
+        auto skeleton = SkeletonSnapshots::Get(tiny);
+        if (skeleton) {
             for (auto &point : CoordsToCheck) {
-                bool StopDamageLookup = false;
-                if (!StopDamageLookup) {
-                    VisitNodes(model, [&nodeCollisions, point, maxFootDistance, &StopDamageLookup](NiAVObject& a_obj) {
-                        float distance = (point - a_obj.world.translate).Length() - Collision_Distance_Override;
-                        if (distance <= maxFootDistance) {
-                            StopDamageLookup = true;
-                            nodeCollisions += 1;
-                            return false;
-                        }
-                        return true;
-                    });
+                if (skeleton->AnyWithinRadius(point, maxFootDistance + Collision_Distance_Override)) {
+                    nodeCollisions += 1;
                 }
             }
             if (nodeCollisions > 0) {
@@ -322,29 +315,11 @@ namespace Gts {
                 }
 
                 NiPoint3 giantLocation = giant->GetPosition();
-                for (auto otherActor: find_actors()) {
+                for (auto otherActor: ActorGrid::FindActorsInRange(giantLocation, BASE_DISTANCE*giantScale*3)) {
                     if (otherActor != giant) {
-                        NiPoint3 actorLocation = otherActor->GetPosition();
-                        if ((actorLocation - giantLocation).Length() < BASE_DISTANCE*giantScale*3) {
-                            int nodeCollisions = 0;
-                            float force = 0.0f;
-
-                            auto model = otherActor->GetCurrent3D();
-
-                            if (model) {
-                                VisitNodes(model, [&nodeCollisions, &force, NodePosition, CheckDistance](NiAVObject& a_obj) {
-                                    float distance = (NodePosition - a_obj.world.translate).Length();
-                                    if (distance < CheckDistance) {
-                                        nodeCollisions += 1;
-                                        force = 1.0f - distance / CheckDistance;
-                                        return false;
-                                    }
-                                    return true;
-                                });
-                            }
-                            if (nodeCollisions > 0) {
-                                TinyCalamity_CrushCheck(giant, otherActor);
-                            }
+                        auto skeleton = SkeletonSnapshots::Get(otherActor);
+                        if (skeleton && skeleton->AnyWithinRadius(NodePosition, CheckDistance)) {
+                            TinyCalamity_CrushCheck(giant, otherActor);
                         }
                     }
                 }
@@ -6,6 +6,7 @@
 #include "data/persistent.hpp"
 #include "scale/scale.hpp"
 #include "managers/animation/AnimationManager.hpp"
+#include "data/time.hpp"
 #include "profiler.hpp"
 #include <nlohmann/json.hpp>
 
@@ -14,6 +15,73 @@ using namespace RE;
 using namespace Gts;
 
 namespace {
+	// After an equip/load the shoe models are read again for this long (seconds)
+	const double RESOLVE_TIME = 1.0;
+
+	// Racemenu SDTA string -> NPC offset, every string is only parsed once
+	std::optional<NiPoint3> ParseSDTA(const std::string& stringDataStr) {
+		try{
+			std::stringstream jsonData(stringDataStr);
+			json j = json::parse(jsonData);
+			for (const auto& alteration: j) {
+				if (alteration.contains("name") && alteration.contains("pos") && alteration["name"] == "NPC" && alteration["pos"].size() > 2) {
+					auto p = alteration["pos"].template get<std::vector<float> >();
+					return NiPoint3(p[0], p[1], p[2]);
+				}
+			}
+			return std::nullopt;
+		} catch (const json::exception& e) {
+			//log::warn("JSON parse error: {}. Using alternate method", e.what());
+
+			auto posStart = stringDataStr.find("\"pos\":[");
+			if (posStart == std::string::npos) {
+				//log::warn("Pos not found in string. High Heel will be disabled");
+				return std::nullopt;
+			}
+
+			posStart += 7;
+			auto posEnd = stringDataStr.find("]", posStart);
+
+			if (posEnd != std::string::npos && posStart != posEnd) {
+				try {
+					std::string posString = stringDataStr.substr(posStart, posEnd - posStart);
+
+					auto posValueStart = 0;
+					auto posValueEnd = static_cast<int>(posString.find(",", posValueStart));
+
+					float pos_x = static_cast<float>(std::stod(posString.substr(posValueStart, posValueEnd - posValueStart)));
+
+					posValueStart = posValueEnd + 1;
+					posValueEnd = static_cast<int>(posString.find(",", posValueStart));
+					float pos_y = static_cast<float>(std::stod(posString.substr(posValueStart, posValueEnd - posValueStart)));
+
+					posValueStart = posValueEnd + 1;
+					float pos_z = static_cast<float>(std::stod(posString.substr(posValueStart)));
+
+					return NiPoint3(pos_x, pos_y, pos_z);
+				} catch (const std::exception& e) {
+					return std::nullopt;
+				}
+			}
+
+			return std::nullopt;
+		} catch (const std::exception& e) {
+			//log::warn("Error while parsing the JSON data: {}", e.what());
+			return std::nullopt;
+		}
+	}
+
+	const std::optional<NiPoint3>& GetSDTAOffset(const char* value) {
+		static std::unordered_map<std::string, std::optional<NiPoint3>> parsed;
+		std::string key = value ? value : "";
+		auto found = parsed.find(key);
+		if (found == parsed.end()) {
+			auto profiler = Profilers::Profile("HH: ParseSDTA");
+			found = parsed.emplace(key, ParseSDTA(key)).first;
+		}
+		return found->second;
+	}
+
 	bool DisableHighHeels(Actor* actor) {
 		bool disable = (
 			AnimationManager::HHDisabled(actor) || !Persistent::GetSingleton().highheel_correction ||
@@ -43,6 +111,7 @@ namespace Gts {
 	}
 
 	void HighHeelManager::ActorEquip(Actor* actor) {
+		HighHeelManager::RequestHHUpdate(actor);
 		ActorHandle actorHandle = actor->CreateRefHandle();
 		std::string taskname = std::format("ActorEquip_{}", actor->formID);
 
@@ -56,6 +125,7 @@ namespace Gts {
 		});
 	}
 	void HighHeelManager::ActorLoaded(Actor* actor) {
+		HighHeelManager::RequestHHUpdate(actor);
 		ActorHandle actorHandle = actor->CreateRefHandle();
 		std::string taskname = std::format("ActorLoaded_{}", actor->formID);
 
@@ -101,21 +171,25 @@ namespace Gts {
 				bool disableHH = DisableHighHeels(actor);
 
 				if (disableHH) {
-					hhData.multiplier.target = 0.0f;
-					hhData.multiplier.halflife = 1 / (AnimationManager::GetAnimSpeed(actor) * AnimationManager::GetHighHeelSpeed(actor) * speedup);
+					hhData.multiplier.SetTarget(0.0f);
+					hhData.multiplier.SetHalfLife(1 / (AnimationManager::GetAnimSpeed(actor) * AnimationManager::GetHighHeelSpeed(actor) * speedup));
 				} else {
-					hhData.multiplier.target = 1.0f;
-					hhData.multiplier.halflife = 1 / (AnimationManager::GetAnimSpeed(actor) * AnimationManager::GetHighHeelSpeed(actor) * speedup);
+					hhData.multiplier.SetTarget(1.0f);
+					hhData.multiplier.SetHalfLife(1 / (AnimationManager::GetAnimSpeed(actor) * AnimationManager::GetHighHeelSpeed(actor) * speedup));
 				}
 
 				NiPoint3 new_hh;
 				if (!Persistent::GetSingleton().highheel_correction) {
 					return;
 				}
-				this->UpdateHHOffset(actor);
+				// Shoe models are only read around equip/load or when the 3D was replaced
+				if (force || Time::WorldTimeElapsed() < hhData.resolveUntil || hhData.resolvedRoot != actor->Get3D(false)) {
+					this->UpdateHHOffset(actor);
+				}
+				hhData.lastBaseHHOffset = hhData.modelHHOffset * get_npcparentnode_scale(actor);
 
 				// With model scale do it in unscaled coords
-				new_hh = this->GetBaseHHOffset(actor) * hhData.multiplier.value;
+				new_hh = this->GetBaseHHOffset(actor) * hhData.multiplier.GetValue();
 				
 				float hh_length = new_hh.Length();
 
@@ -162,65 +236,26 @@ namespace Gts {
 					return false;
 				});
 				VisitExtraData<NiStringExtraData>(model, "SDTA", [&result](NiAVObject& currentnode, NiStringExtraData& data) {
-					std::string stringDataStr = data.value;
-					try{
-						std::stringstream jsonData(stringDataStr);
-						json j = json::parse(jsonData);
-						for (const auto& alteration: j) {
-							if (alteration.contains("name") && alteration.contains("pos") && alteration["name"] == "NPC" && alteration["pos"].size() > 2) {
-								auto p = alteration["pos"].template get<std::vector<float> >();
-								result = NiPoint3(p[0], p[1], p[2]);
-								return false;
-							}
-						}
-						return true;
-					} catch (const json::exception& e) {
-						//log::warn("JSON parse error: {}. Using alternate method", e.what());
-
-						auto posStart = stringDataStr.find("\"pos\":[");
-						if (posStart == std::string::npos) {
-							//log::warn("Pos not found in string. High Heel will be disabled");
-							return true;
-						}
-
-						posStart += 7;
-						auto posEnd = stringDataStr.find("]", posStart);
-
-						if (posEnd != std::string::npos && posStart != posEnd) {
-								
-							std::string posString = stringDataStr.substr(posStart, posEnd - posStart);
-
-							auto posValueStart = 0;
-							auto posValueEnd = static_cast<int>(posString.find(",", posValueStart));
-							
-							float pos_x = static_cast<float>(std::stod(posString.substr(posValueStart, posValueEnd - posValueStart)));
-							
-							posValueStart = posValueEnd + 1;
-							posValueEnd = static_cast<int>(posString.find(",", posValueStart));
-							float pos_y = static_cast<float>(std::stod(posString.substr(posValueStart, posValueEnd - posValueStart)));
-							
-							posValueStart = posValueEnd + 1;
-							float pos_z = static_cast<float>(std::stod(posString.substr(posValueStart)));
-
-							result = NiPoint3(pos_x, pos_y, pos_z);
-							return false;
-						}
-
-						return true;
-					} catch (const std::exception& e) {
-						//log::warn("Error while parsing the JSON data: {}", e.what());
-						return true;
+					auto& offset = GetSDTAOffset(data.value);
+					if (offset) {
+						result = *offset;
+						return false;
 					}
+					return true;
 				});
 			}
 		}
 		//log::info("Base HHOffset: {}", Vector2Str(result));
-		auto npcNodeScale = get_npcparentnode_scale(actor);
+		auto& me = HighHeelManager::GetSingleton();
+		auto& hhData = me.data[actor];
+		hhData.modelHHOffset = result;
+		hhData.resolvedRoot = actor->Get3D(false);
+	}
 
+	void HighHeelManager::RequestHHUpdate(Actor* actor) {
 		auto& me = HighHeelManager::GetSingleton();
-		me.data.try_emplace(actor);
 		auto& hhData = me.data[actor];
-		hhData.lastBaseHHOffset = result * npcNodeScale;
+		hhData.resolveUntil = Time::WorldTimeElapsed() + RESOLVE_TIME;
 	}
 
 	NiPoint3 HighHeelManager::GetBaseHHOffset(Actor* actor) {
@@ -241,7 +276,7 @@ namespace Gts {
 		auto& me = HighHeelManager::GetSingleton();
 		me.data.try_emplace(actor);
 		auto& hhData = me.data[actor];
-		return hhData.multiplier.value;
+		return hhData.multiplier.GetValue();
 	}
 	bool HighHeelManager::IsWearingHH(Actor* actor) {
 		return HighHeelManager::GetBaseHHOffset(actor).Length() > 1e-3;
@@ -11,6 +11,12 @@ namespace Gts {
 		Spring multiplier = Spring(1.0f, 0.5f); // Used to smotthly disable/enable the highheels
 		bool wasWearingHh = false;
 		NiPoint3 lastBaseHHOffset;
+		// Offset read from the shoe models, before the NPC parent node scale
+		NiPoint3 modelHHOffset;
+		// 3D the offset was read from, a new 3D means it has to be read again
+		NiAVObject* resolvedRoot = nullptr;
+		// Models are read every tick until then, equipped shoes can take a few frames to be attached
+		double resolveUntil = 0.0;
 	};
 
 	class HighHeelManager : public EventListener {
@@ -24,7 +30,8 @@ namespace Gts {
 			virtual void OnAddPerk(const AddPerkEvent& evt) override;
 
 			static bool IsWearingHH(Actor* actor); // Checks if GetBaseHHOffset().Length() > 1e-4
-			static void UpdateHHOffset(Actor* actor);
+			static void UpdateHHOffset(Actor* actor); // Reads the HH offset from the worn shoe models
+			static void RequestHHUpdate(Actor* actor); // Shoe models are read again on the next ticks
 			static NiPoint3 GetBaseHHOffset(Actor* actor); // Unscaled HH as read from the shoe data
 			static NiPoint3 GetHHOffset(Actor* actor); // Scaled HH
 			static float GetHHMultiplier(Actor* actor); // get current multiplier of HH
@@ -17,6 +17,7 @@
 #include "managers/RandomGrowth.hpp"
 #include "managers/Attributes.hpp"
 #include "managers/GtsManager.hpp"
+#include "managers/FadeManager.hpp"
 #include "managers/hitmanager.hpp"
 #include "managers/footik/collider.hpp"
 #include "managers/explosion.hpp"
@@ -25,22 +26,39 @@
 #include "managers/highheel.hpp"
 #include "managers/audio/footstep.hpp"
 #include "managers/contact.hpp"
+#include "managers/cameras/tracking.hpp"
 #include "managers/camera.hpp"
 #include "managers/tremor.hpp"
 #include "managers/rumble.hpp"
 #include "managers/vore.hpp"
 #include "utils/DynamicScale.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "utils/ActorGrid.hpp"
+#include "utils/UpdateScheduler.hpp"
+#include "utils/ObjectGrid.hpp"
+#include "utils/SkeletonSnapshot.hpp"
+#include "utils/NodeIndex.hpp"
+#include "utils/CollisionRecords.hpp"
+#include "utils/BehaviorGraphIndex.hpp"
 #include "magic/magic.hpp"
 #include "events.hpp"
 
 namespace Gts {
 	void RegisterManagers() {
+		EventDispatcher::AddListener(&ActorRegistry::GetSingleton()); // Resolves loaded actors once per frame, must stay first
+		EventDispatcher::AddListener(&ActorGrid::GetSingleton()); // Spatial hash of loaded actors, rebuilt once per frame
+		EventDispatcher::AddListener(&UpdateScheduler::GetSingleton()); // Update rates of per actor work by importance, forgets unloaded actors
+		EventDispatcher::AddListener(&ObjectGrid::GetSingleton()); // Spatial hash of loose objects that can be launched, updated as cells attach
+		EventDispatcher::AddListener(&SkeletonSnapshots::GetSingleton()); // Per-frame node positions for contact checks
+		EventDispatcher::AddListener(&NodeIndex::GetSingleton()); // Cached name -> node lookups for find_node
 		EventDispatcher::AddListener(&GameModeManager::GetSingleton()); // Manages Game Modes
 		EventDispatcher::AddListener(&GtsManager::GetSingleton()); // Manages smooth size increase and animation & movement speed
+		EventDispatcher::AddListener(&FadeManager::GetSingleton()); // Stops large actors from fading out, after their scale was updated
 		//EventDispatcher::AddListener(&AttackManager::GetSingleton()); // Manages disallowing of Attack at large scales for NPC's
 		EventDispatcher::AddListener(&PerkHandler::GetSingleton()); // Manages some perk updates
 		EventDispatcher::AddListener(&SizeManager::GetSingleton()); // Manages Max Scale of everyone
 		EventDispatcher::AddListener(&HighHeelManager::GetSingleton()); // Applies high heels
+		EventDispatcher::AddListener(&BoneTracker::GetSingleton()); // Cached nodes of the camera bone targets
 		EventDispatcher::AddListener(&CameraManager::GetSingleton()); // Edits the camera
 		EventDispatcher::AddListener(&ReloadManager::GetSingleton()); // Handles Skyrim Events
 		EventDispatcher::AddListener(&CollisionDamage::GetSingleton()); // Handles precise size-related damage
@@ -65,6 +83,8 @@ namespace Gts {
 		EventDispatcher::AddListener(&Grab::GetSingleton()); // Manages grabbing
 		EventDispatcher::AddListener(&ThighSandwichController::GetSingleton()); // Manages Thigh Sandwiching
 		EventDispatcher::AddListener(&AnimationBoobCrush::GetSingleton());
+		EventDispatcher::AddListener(&CollisionRecords::GetSingleton()); // Per-frame actor data for the Havok collision filter, after scales and grabs were updated
+		EventDispatcher::AddListener(&BehaviorGraphIndex::GetSingleton()); // Anim speed of every behavior graph, after the animation managers changed it
 
 		EventDispatcher::AddListener(&AiManager::GetSingleton()); // Rough AI controller for GTS-actions
 		EventDispatcher::AddListener(&Headtracking::GetSingleton()); // Headtracking fixes
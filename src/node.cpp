@@ -1,5 +1,5 @@
 #include "node.hpp"
-#include <regex>
+#include "utils/NodeIndex.hpp"
 #include "data/plugin.hpp"
 
 using namespace SKSE;
@@ -59,7 +59,7 @@ namespace Gts {
 						}
 					}
 					// Do smth
-					log::trace("Node {}", currentnode->name);
+					GTS_LOG_TRACE("Node {}", currentnode->name);
 				} else if (counter > loop_threshold) {
 					queue.clear();
 				}
@@ -113,7 +113,7 @@ namespace Gts {
 						}
 					}
 					// Do smth
-					log::trace("Node {}", currentnode->name);
+					GTS_LOG_TRACE("Node {}", currentnode->name);
 				} else if (counter > loop_threshold) {
 					queue.clear();
 				}
@@ -145,65 +145,7 @@ namespace Gts {
 		if (!model) {
 			return nullptr;
 		}
-		auto node_lookup = model->GetObjectByName(node_name);
-		if (node_lookup) {
-			return node_lookup;
-		}
-
-		// Game lookup failed we try and find it manually
-		std::deque<NiAVObject*> queue;
-		queue.push_back(model);
-
-        int counter = 0;
-
-		while (!queue.empty()) {
-			auto currentnode = queue.front();
-			queue.pop_front();
-
-			counter += 1;
-			try {
-				if (currentnode) {
-					auto ninode = currentnode->AsNode();
-					if (ninode) {
-						for (auto &child : ninode->GetChildren()) {
-							// Bredth first search
-							if (child) {
-								queue.push_back(child.get());
-							}
-							// Depth first search
-							//queue.push_front(child.get());
-						}
-					} 
-					// Do smth
-					if (currentnode->name.c_str() == node_name) {
-						log::info("Found bone: {}", node_name);
-						return currentnode;
-					} else if (counter > loop_threshold) {
-						//log::info("Counter {} on {} is > than size {}", counter, actor->GetDisplayFullName(), queue.size());
-						queue.clear();
-						return nullptr;
-					}
-				}
-			}
-			catch (const std::overflow_error& e) {
-				log::warn("Overflow: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::overflow_error (same type rule)
-			catch (const std::runtime_error& e) {
-				log::warn("Underflow: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::underflow_error (base class rule)
-			catch (const std::exception& e) {
-				log::warn("Exception: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::logic_error (base class rule)
-			catch (...) {
-				log::warn("Exception Other");
-				return nullptr;
-				}
-			}
-
-		return nullptr;
+		return NodeIndex::Find(actor, model, node_name);
 	}
 
 
@@ -212,64 +154,7 @@ namespace Gts {
 		if (!model) {
 			return nullptr;
 		}
-		auto node_lookup = model->GetObjectByName(node_name);
-		if (node_lookup) {
-			return node_lookup;
-		}
-
-		// Game lookup failed we try and find it manually
-		std::deque<NiAVObject*> queue;
-		queue.push_back(model);
-		
-		int counter = 0;
-
-		while (!queue.empty()) {
-			auto currentnode = queue.front();
-			queue.pop_front();
-
-			counter += 1;
-
-			try {
-				if (currentnode) {
-					auto ninode = currentnode->AsNode();
-					if (ninode) {
-						for (auto &child : ninode->GetChildren()) {
-							// Bredth first search
-							if (child) {
-								queue.push_back(child.get());
-							}
-							// Depth first search
-							//queue.push_front(child.get());
-						}
-					}
-					// Do smth
-					if (currentnode->name.c_str() == node_name) {
-						return currentnode;
-					} else if (counter > loop_threshold) {
-						queue.clear();
-						return nullptr;
-					}
-				}
-			}
-			catch (const std::overflow_error& e) {
-				log::warn("Overflow: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::overflow_error (same type rule)
-			catch (const std::runtime_error& e) {
-				log::warn("Underflow: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::underflow_error (base class rule)
-			catch (const std::exception& e) {
-				log::warn("Exception: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::logic_error (base class rule)
-			catch (...) {
-				log::warn("Exception Other");
-				return nullptr;
-			}
-		}
-
-		return nullptr;
+		return NodeIndex::Find(object, model, node_name);
 	}
 
 	NiAVObject* find_node_regex(Actor* actor, std::string_view node_regex, bool first_person) {
@@ -280,62 +165,7 @@ namespace Gts {
 		if (!model) {
 			return nullptr;
 		}
-
-		std::regex the_regex(std::string(node_regex).c_str());
-
-		// Game lookup failed we try and find it manually
-		std::deque<NiAVObject*> queue;
-		queue.push_back(model);
-
-		int counter = 0;
-
-		while (!queue.empty()) {
-			auto currentnode = queue.front();
-			queue.pop_front();
-
-			counter += 1;
-
-			try {
-				if (currentnode) {
-					auto ninode = currentnode->AsNode();
-					if (ninode) {
-						for (auto &child : ninode->GetChildren()) {
-							// Bredth first search
-							if (child) {
-								queue.push_back(child.get());
-							}
-							// Depth first search
-							//queue.push_front(child.get());
-						}
-					}
-					// Do smth
-					if (std::regex_match(currentnode->name.c_str(), the_regex)) {
-						return currentnode;
-					} else if (counter > loop_threshold) {
-						queue.clear();
-						return nullptr;
-					}
-				}
-			}
-			catch (const std::overflow_error& e) {
-				log::warn("Overflow: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::overflow_error (same type rule)
-			catch (const std::runtime_error& e) {
-				log::warn("Underflow: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::underflow_error (base class rule)
-			catch (const std::exception& e) {
-				log::warn("Exception: {}", e.what());
-				return nullptr;
-			} // this executes if f() throws std::logic_error (base class rule)
-			catch (...) {
-				log::warn("Exception Other");
-				return nullptr;
-			}
-		}
-
-		return nullptr;
+		return NodeIndex::FindRegex(actor, model, node_regex);
 	}
 
 	NiAVObject* find_node_any(Actor* actor, std::string_view name) {
@@ -404,7 +234,7 @@ namespace Gts {
 								if (hkp_rigidbody) {
 									auto shape = hkp_rigidbody->GetShape();
 									if (shape) {
-										log::trace("Shape found: {} for {}", typeid(*shape).name(), currentnode->name.c_str());
+										GTS_LOG_TRACE("Shape found: {} for {}", typeid(*shape).name(), currentnode->name.c_str());
 										if (shape->type == hkpShapeType::kCapsule) {
 											const hkpCapsuleShape* orig_capsule = static_cast<const hkpCapsuleShape*>(shape);
 											hkTransform identity;
@@ -418,10 +248,10 @@ namespace Gts {
 											float max[4] = {0.0f};
 											_mm_store_ps(&min[0], out.min.quad);
 											_mm_store_ps(&max[0], out.max.quad);
-											log::trace(" - Current bounds: {},{},{}<{},{},{}", min[0], min[1],min[2], max[0],max[1],max[2]);
+											GTS_LOG_TRACE(" - Current bounds: {},{},{}<{},{},{}", min[0], min[1],min[2], max[0],max[1],max[2]);
 											// Here be dragons
 											hkpCapsuleShape* capsule = const_cast<hkpCapsuleShape*>(orig_capsule);
-											log::trace("  - Capsule found: {}", typeid(*orig_capsule).name());
+											GTS_LOG_TRACE("  - Capsule found: {}", typeid(*orig_capsule).name());
 											float scale_factor = new_scale / prev_scale;
 											hkVector4 vec_scale = hkVector4(scale_factor);
 											capsule->vertexA = capsule->vertexA * vec_scale;
@@ -431,11 +261,11 @@ namespace Gts {
 											capsule->GetAabbImpl(identity, 1e-3f, out);
 											_mm_store_ps(&min[0], out.min.quad);
 											_mm_store_ps(&max[0], out.max.quad);
-											log::trace(" - New bounds: {},{},{}<{},{},{}", min[0], min[1],min[2], max[0],max[1],max[2]);
-											log::trace(" - pad28: {}", orig_capsule->pad28);
-											log::trace(" - pad2C: {}", orig_capsule->pad2C);
-											log::trace(" - float(pad28): {}", static_cast<float>(orig_capsule->pad28));
-											log::trace(" - float(pad2C): {}", static_cast<float>(orig_capsule->pad2C));
+											GTS_LOG_TRACE(" - New bounds: {},{},{}<{},{},{}", min[0], min[1],min[2], max[0],max[1],max[2]);
+											GTS_LOG_TRACE(" - pad28: {}", orig_capsule->pad28);
+											GTS_LOG_TRACE(" - pad2C: {}", orig_capsule->pad2C);
+											GTS_LOG_TRACE(" - float(pad28): {}", static_cast<float>(orig_capsule->pad28));
+											GTS_LOG_TRACE(" - float(pad2C): {}", static_cast<float>(orig_capsule->pad2C));
 
 											hkp_rigidbody->SetShape(capsule);
 										}
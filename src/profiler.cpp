@@ -1,108 +1,406 @@
 #include "profiler.hpp"
 #include "Config.hpp"
 #include "data/time.hpp"
+#include "skselog.hpp"
 #include <chrono>
+#include <fstream>
 
-namespace Gts {
-	Profiler::Profiler(std::string_view name) : name(std::string(name)) {
+using namespace Gts;
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	const std::size_t NAME_LENGTH = 64;
+	const std::size_t MAX_DEPTH = 64;
+
+	struct ZoneData {
+		// 0 while the slot is free
+		std::atomic<std::uint64_t> hash {0};
+		std::atomic<bool> ready {false};
+		char name[NAME_LENGTH] = {};
+		// Zone this one was first opened inside of
+		std::atomic<ProfilerZoneId> parent {Profilers::INVALID_ZONE};
+
+		// Added to from any thread
+		std::atomic<std::uint64_t> frameNanos {0};
+		std::atomic<std::uint32_t> frameCalls {0};
+
+		// Main thread only, milliseconds per frame
+		std::array<float, Profilers::HISTORY_FRAMES> history = {};
+		std::uint64_t reportNanos = 0;
+		std::uint64_t reportCalls = 0;
+	};
+
+	// sequence is the event index + 1 once the event is fully written
+	struct TraceEvent {
+		std::atomic<std::uint64_t> sequence {0};
+		std::atomic<ProfilerZoneId> zone {0};
+		std::atomic<std::uint32_t> thread {0};
+		std::atomic<std::uint64_t> start {0};
+		std::atomic<std::uint64_t> duration {0};
+	};
+
+	struct ProfilerState {
+		std::array<ZoneData, Profilers::MAX_ZONES> zones;
+		std::array<TraceEvent, Profilers::MAX_TRACE_EVENTS> trace;
+		std::atomic<std::uint64_t> traceHead {0};
+		// Time spent inside outermost zones (any thread)
+		std::atomic<std::uint64_t> totalNanos {0};
+		std::atomic<std::uint32_t> threadCount {0};
+		Clock::time_point epoch = Clock::now();
+
+		// Main thread only
+		std::uint64_t framesRecorded = 0;
+		std::uint64_t reportFrames = 0;
+	};
+
+	ProfilerState& State() {
+		static ProfilerState state;
+		return state;
+	}
+
+	struct OpenZone {
+		ProfilerZoneId zone;
+		std::uint64_t start;
+	};
+
+	struct ThreadStack {
+		std::array<OpenZone, MAX_DEPTH> open;
+		std::uint32_t depth = 0;
+		std::uint32_t thread = State().threadCount.fetch_add(1, std::memory_order_relaxed);
+	};
+
+	ThreadStack& Stack() {
+		thread_local ThreadStack stack;
+		return stack;
+	}
 
+	std::uint64_t Now() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - State().epoch).count();
 	}
 
-	void Profiler::Start()
-	{
-		if (!this->running) {
-			m_beg = Clock::now();
-			this->running = true;
+	std::uint64_t HashName(std::string_view name) {
+		// FNV-1a, 0 is reserved for empty slots
+		std::uint64_t hash = 0xcbf29ce484222325ull;
+		for (char c: name) {
+			hash ^= static_cast<std::uint8_t>(c);
+			hash *= 0x100000001b3ull;
 		}
+		return hash == 0 ? 1 : hash;
 	}
 
-	void Profiler::Stop()
-	{
-		if (this->running) {
-			this->elapsed += RunningTime();
-			this->running = false;
+	bool ShouldProfile() {
+		return Config::GetSingleton().GetDebug().ShouldProfile();
+	}
+
+	void RecordTrace(ProfilerZoneId zone, std::uint32_t thread, std::uint64_t start, std::uint64_t duration) {
+		auto& state = State();
+		std::uint64_t index = state.traceHead.fetch_add(1, std::memory_order_relaxed);
+		auto& event = state.trace[index % Profilers::MAX_TRACE_EVENTS];
+		event.sequence.store(0, std::memory_order_relaxed);
+		event.zone.store(zone, std::memory_order_relaxed);
+		event.thread.store(thread, std::memory_order_relaxed);
+		event.start.store(start, std::memory_order_relaxed);
+		event.duration.store(duration, std::memory_order_relaxed);
+		event.sequence.store(index + 1, std::memory_order_release);
+	}
+
+	struct ZoneStats {
+		float min = 0.0f;
+		float avg = 0.0f;
+		float p99 = 0.0f;
+	};
+
+	ZoneStats GetStats(const ZoneData& zone, std::size_t frames) {
+		ZoneStats stats;
+		if (frames == 0) {
+			return stats;
 		}
+		std::array<float, Profilers::HISTORY_FRAMES> sorted = zone.history;
+		float sum = 0.0f;
+		stats.min = std::numeric_limits<float>::max();
+		for (std::size_t i = 0; i < frames; i++) {
+			sum += sorted[i];
+			stats.min = std::min(stats.min, sorted[i]);
+		}
+		stats.avg = sum / frames;
+		auto p99 = sorted.begin() + static_cast<std::size_t>(0.99 * (frames - 1));
+		std::nth_element(sorted.begin(), p99, sorted.begin() + frames);
+		stats.p99 = *p99;
+		return stats;
 	}
 
-	void Profiler::Reset()
-	{
-		this->elapsed = 0.0f;
+	// Parents before children, children indented under them
+	void CollectTree(ProfilerZoneId parent, std::uint32_t depth, std::vector<std::pair<ProfilerZoneId, std::uint32_t>>& order, std::vector<bool>& visited) {
+		auto& zones = State().zones;
+		for (ProfilerZoneId id = 0; id < Profilers::MAX_ZONES; id++) {
+			if (visited[id] || !zones[id].ready.load(std::memory_order_acquire)) {
+				continue;
+			}
+			ProfilerZoneId zoneParent = zones[id].parent.load(std::memory_order_relaxed);
+			bool isRoot = zoneParent == Profilers::INVALID_ZONE || !zones[zoneParent].ready.load(std::memory_order_acquire);
+			if ((parent == Profilers::INVALID_ZONE && isRoot) || (parent != Profilers::INVALID_ZONE && zoneParent == parent)) {
+				visited[id] = true;
+				order.push_back({id, depth});
+				CollectTree(id, depth + 1, order, visited);
+			}
+		}
 	}
 
-	double Profiler::Elapsed() {
-		if (this->IsRunning()) {
-			return this->elapsed + this->RunningTime();
-		} else {
-			return this->elapsed;
+	std::optional<std::filesystem::path> ExportPath(std::string_view filename) {
+		auto path = Gts::log_directory();
+		if (path) {
+			*path /= filename;
 		}
+		return path;
 	}
 
-	bool Profiler::IsRunning() {
-		return this->running;
+	void WriteCsv(std::size_t frames) {
+		auto path = ExportPath("GtsProfile.csv");
+		if (!path) {
+			return;
+		}
+		std::ofstream file(*path, std::ios::trunc);
+		if (!file) {
+			log::warn("Could not write {}", path->string());
+			return;
+		}
+		auto& state = State();
+		file << "frame,zone,parent,ms\n";
+		std::uint64_t firstFrame = state.framesRecorded - frames;
+		for (std::uint64_t frame = firstFrame; frame < state.framesRecorded; frame++) {
+			std::size_t slot = frame % Profilers::HISTORY_FRAMES;
+			for (auto& zone: state.zones) {
+				if (!zone.ready.load(std::memory_order_acquire)) {
+					continue;
+				}
+				ProfilerZoneId parent = zone.parent.load(std::memory_order_relaxed);
+				std::string_view parentName = parent == Profilers::INVALID_ZONE ? "" : state.zones[parent].name;
+				file << std::format("{},\"{}\",\"{}\",{:.4f}\n", frame, zone.name, parentName, zone.history[slot]);
+			}
+		}
 	}
 
-	double Profiler::RunningTime() {
-		if (this->running) {
-			return std::chrono::duration_cast<Second>(Clock::now() - m_beg).count();
-		} else {
-			return 0;
+	void WriteTrace() {
+		auto path = ExportPath("GtsProfile.json");
+		if (!path) {
+			return;
+		}
+		std::ofstream file(*path, std::ios::trunc);
+		if (!file) {
+			log::warn("Could not write {}", path->string());
+			return;
+		}
+		auto& state = State();
+		std::uint64_t head = state.traceHead.load(std::memory_order_acquire);
+		std::uint64_t first = head > Profilers::MAX_TRACE_EVENTS ? head - Profilers::MAX_TRACE_EVENTS : 0;
+		file << "{\"traceEvents\":[";
+		bool firstEvent = true;
+		for (std::uint64_t index = first; index < head; index++) {
+			auto& event = state.trace[index % Profilers::MAX_TRACE_EVENTS];
+			if (event.sequence.load(std::memory_order_acquire) != index + 1) {
+				continue;
+			}
+			ProfilerZoneId zone = event.zone.load(std::memory_order_relaxed);
+			std::uint32_t thread = event.thread.load(std::memory_order_relaxed);
+			std::uint64_t start = event.start.load(std::memory_order_relaxed);
+			std::uint64_t duration = event.duration.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (event.sequence.load(std::memory_order_relaxed) != index + 1) {
+				// Overwritten while reading
+				continue;
+			}
+			std::string name = state.zones[zone].name;
+			std::erase_if(name, [](char c) {
+				return c == '"' || c == '\\';
+			});
+			file << std::format("{}{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", firstEvent ? "" : ",\n", name, thread, start / 1000.0, duration / 1000.0);
+			firstEvent = false;
 		}
+		file << "]}\n";
+	}
+}
+
+namespace Gts {
+	ProfilerZone::ProfilerZone(std::string_view name) : name(std::string(name)), id(Profilers::INVALID_ZONE) {
 	}
 
-	std::string Profiler::GetName() {
-		return this->name;
+	ProfilerZoneId ProfilerZone::GetId() const {
+		ProfilerZoneId current = this->id.load(std::memory_order_relaxed);
+		if (current == Profilers::INVALID_ZONE) {
+			current = Profilers::Register(this->name);
+			this->id.store(current, std::memory_order_relaxed);
+		}
+		return current;
 	}
 
-	ProfilerHandle::ProfilerHandle(std::string_view name) : name(std::string(name)) {
-		Profilers::Start(name);
+	ProfilerHandle::ProfilerHandle(ProfilerZoneId zone) : zone(zone), started(Profilers::Start(zone)) {
 	}
 
 	ProfilerHandle::~ProfilerHandle() {
-		Profilers::Stop(this->name);
+		if (this->started) {
+			Profilers::Stop(this->zone);
+		}
 	}
 
 	ProfilerHandle Profilers::Profile(std::string_view name) {
-		return ProfilerHandle(name);
+		if (!ShouldProfile()) {
+			return ProfilerHandle(INVALID_ZONE);
+		}
+		return ProfilerHandle(Profilers::Register(name));
 	}
 
-	void Profilers::Start(std::string_view name) {
-		if (Config::GetSingleton().GetDebug().ShouldProfile()) {
-			auto& me = Profilers::GetSingleton();
-			auto key = std::string(name);
-			me.profilers.try_emplace(key, name);
-			me.profilers.at(key).Start();
-			if (me.AnyRunning()) {
-				me.totalTime.Start();
+	ProfilerHandle Profilers::Profile(const ProfilerZone& zone) {
+		if (!ShouldProfile()) {
+			return ProfilerHandle(INVALID_ZONE);
+		}
+		return ProfilerHandle(zone.GetId());
+	}
+
+	ProfilerZoneId Profilers::Register(std::string_view name) {
+		auto& zones = State().zones;
+		std::uint64_t hash = HashName(name);
+		std::size_t mask = MAX_ZONES - 1;
+		std::size_t slot = hash & mask;
+		for (std::size_t probe = 0; probe < MAX_ZONES; probe++, slot = (slot + 1) & mask) {
+			auto& zone = zones[slot];
+			std::uint64_t current = zone.hash.load(std::memory_order_acquire);
+			if (current == 0) {
+				if (zone.hash.compare_exchange_strong(current, hash, std::memory_order_acq_rel)) {
+					std::size_t length = std::min(name.size(), NAME_LENGTH - 1);
+					std::memcpy(zone.name, name.data(), length);
+					zone.name[length] = '\0';
+					zone.ready.store(true, std::memory_order_release);
+					return static_cast<ProfilerZoneId>(slot);
+				}
+				// Another thread took the slot, current now holds its hash
+			}
+			if (current == hash) {
+				while (!zone.ready.load(std::memory_order_acquire)) {
+					std::this_thread::yield();
+				}
+				return static_cast<ProfilerZoneId>(slot);
+			}
+		}
+		return INVALID_ZONE;
+	}
+
+	ProfilerZoneId Profilers::Find(std::string_view name) {
+		auto& zones = State().zones;
+		std::uint64_t hash = HashName(name);
+		std::size_t mask = MAX_ZONES - 1;
+		std::size_t slot = hash & mask;
+		for (std::size_t probe = 0; probe < MAX_ZONES; probe++, slot = (slot + 1) & mask) {
+			auto& zone = zones[slot];
+			std::uint64_t current = zone.hash.load(std::memory_order_acquire);
+			if (current == 0) {
+				// Slots are never freed, the name would have been placed here
+				return INVALID_ZONE;
 			}
+			if (current == hash) {
+				return zone.ready.load(std::memory_order_acquire) ? static_cast<ProfilerZoneId>(slot) : INVALID_ZONE;
+			}
+		}
+		return INVALID_ZONE;
+	}
+
+	void Profilers::Start(std::string_view name) {
+		if (ShouldProfile()) {
+			Profilers::Start(Profilers::Register(name));
 		}
 	}
 
 	void Profilers::Stop(std::string_view name) {
-		if (Config::GetSingleton().GetDebug().ShouldProfile()) {
-			auto& me = Profilers::GetSingleton();
-			auto key = std::string(name);
-			me.profilers.try_emplace(key, name);
-			me.profilers.at(key).Stop();
-			if (!me.AnyRunning()) {
-				me.totalTime.Stop();
+		if (Stack().depth > 0) {
+			// A zone that was never started has nothing to close, registering it would add an empty row
+			Profilers::Stop(Profilers::Find(name));
+		}
+	}
+
+	bool Profilers::Start(ProfilerZoneId zone) {
+		if (zone == INVALID_ZONE || !ShouldProfile()) {
+			return false;
+		}
+		auto& stack = Stack();
+		if (stack.depth >= MAX_DEPTH) {
+			return false;
+		}
+		for (std::uint32_t i = 0; i < stack.depth; i++) {
+			if (stack.open[i].zone == zone) {
+				// Already running on this thread, the outer one covers it
+				return false;
 			}
 		}
+		if (stack.depth > 0) {
+			auto& data = State().zones[zone];
+			ProfilerZoneId expected = INVALID_ZONE;
+			data.parent.compare_exchange_strong(expected, stack.open[stack.depth - 1].zone, std::memory_order_relaxed);
+		}
+		stack.open[stack.depth] = OpenZone {
+			.zone = zone,
+			.start = Now(),
+		};
+		stack.depth += 1;
+		return true;
 	}
 
-	bool Profilers::AnyRunning() {
-		for (auto& [key, profiler]: this->profilers) {
-			if (profiler.IsRunning()) {
-				return true;
+	void Profilers::Stop(ProfilerZoneId zone) {
+		auto& stack = Stack();
+		if (zone == INVALID_ZONE || stack.depth == 0) {
+			return;
+		}
+		// Normally the top one, Start/Stop by name may close out of order
+		std::uint32_t index = stack.depth;
+		while (index > 0) {
+			index -= 1;
+			if (stack.open[index].zone == zone) {
+				break;
 			}
 		}
-		return false;
+		if (stack.open[index].zone != zone) {
+			return;
+		}
+
+		auto& state = State();
+		std::uint64_t start = stack.open[index].start;
+		std::uint64_t duration = Now() - start;
+		auto& data = state.zones[zone];
+		data.frameNanos.fetch_add(duration, std::memory_order_relaxed);
+		data.frameCalls.fetch_add(1, std::memory_order_relaxed);
+		if (index == 0) {
+			state.totalNanos.fetch_add(duration, std::memory_order_relaxed);
+		}
+		if (Config::GetSingleton().GetDebug().ShouldExportProfileTrace()) {
+			RecordTrace(zone, stack.thread, start, duration);
+		}
+
+		for (std::uint32_t i = index + 1; i < stack.depth; i++) {
+			stack.open[i - 1] = stack.open[i];
+		}
+		stack.depth -= 1;
 	}
 
-	void Profilers::Report() {
-		for (auto& [name, profiler]: Profilers::GetSingleton().profilers) {
-			if (profiler.IsRunning()) {
-				log::warn("The profiler {} is still running", name);
+	void Profilers::EndFrame() {
+		auto& state = State();
+		std::size_t slot = state.framesRecorded % HISTORY_FRAMES;
+		for (auto& zone: state.zones) {
+			if (!zone.ready.load(std::memory_order_acquire)) {
+				continue;
 			}
+			std::uint64_t nanos = zone.frameNanos.exchange(0, std::memory_order_relaxed);
+			zone.history[slot] = static_cast<float>(nanos / 1e6);
+			zone.reportNanos += nanos;
+			zone.reportCalls += zone.frameCalls.exchange(0, std::memory_order_relaxed);
+		}
+		state.framesRecorded += 1;
+		state.reportFrames += 1;
+	}
+
+	void Profilers::Report() {
+		auto& state = State();
+		auto& stack = Stack();
+		for (std::uint32_t i = 0; i < stack.depth; i++) {
+			log::warn("The profiler {} is still running", state.zones[stack.open[i].zone].name);
 		}
 		std::string report = "Reporting Profilers:";
 		report += std::format("\n|{:20}|", "Name");
@@ -110,36 +408,55 @@ namespace Gts {
 		report += std::format("{:15s}|",                        "% OurCode");
 		report += std::format("{:15s}|",                        "s per frame");
 		report += std::format("{:15s}|",                        "% of frame");
-		report += "\n------------------------------------------------------------------------------------------------";
+		report += std::format("{:10s}|",                        "calls");
+		report += std::format("{:10s}|",                        "min ms");
+		report += std::format("{:10s}|",                        "avg ms");
+		report += std::format("{:10s}|",                        "p99 ms");
+		report += "\n------------------------------------------------------------------------------------------------------------------------------------------------";
 
-		static std::uint64_t last_report_frame = 0;
 		static double last_report_time = 0.0;
-		std::uint64_t current_report_frame = Time::FramesElapsed();
 		double current_report_time = Time::WorldTimeElapsed();
 		double total_time = current_report_time - last_report_time;
+		std::uint64_t frames = std::max<std::uint64_t>(state.reportFrames, 1);
+		std::size_t historyFrames = static_cast<std::size_t>(std::min<std::uint64_t>(state.framesRecorded, HISTORY_FRAMES));
+
+		double total = state.totalNanos.exchange(0, std::memory_order_relaxed) / 1e9;
+
+		std::vector<std::pair<ProfilerZoneId, std::uint32_t>> order;
+		std::vector<bool> visited(MAX_ZONES, false);
+		CollectTree(INVALID_ZONE, 0, order, visited);
+		// Zones whose parents form a cycle are never reached from a root
+		for (ProfilerZoneId id = 0; id < MAX_ZONES; id++) {
+			if (!visited[id] && state.zones[id].ready.load(std::memory_order_acquire)) {
+				order.push_back({id, 0});
+			}
+		}
 
-		double total = Profilers::GetSingleton().totalTime.Elapsed();
-		for (auto& [name, profiler]: Profilers::GetSingleton().profilers) {
-			double elapsed = profiler.Elapsed();
-			double spf = elapsed / (current_report_frame - last_report_frame);
+		for (auto& [id, depth]: order) {
+			auto& zone = state.zones[id];
+			double elapsed = zone.reportNanos / 1e9;
+			double spf = elapsed / frames;
 			double time_percent = elapsed/total_time*100.0;
-			std::string shortenedName = name;
+			ZoneStats stats = GetStats(zone, historyFrames);
+			std::string shortenedName = std::string(std::min<std::size_t>(depth, 4) * 2, ' ') + zone.name;
 			if (shortenedName.length() > 19) {
 				shortenedName = shortenedName.substr(0, 18) + "…";
 			}
-			report += std::format("\n {:20}:					{:15.3f}|{:14.1f}%|{:15.3f}|{:14.3f}%", shortenedName, elapsed, elapsed*100.0f/total, spf, time_percent);
-			profiler.Reset();
+			report += std::format("\n {:20}:					{:15.3f}|{:14.1f}%|{:15.3f}|{:14.3f}%|{:10}|{:10.3f}|{:10.3f}|{:10.3f}", shortenedName, elapsed, total > 0.0 ? elapsed*100.0f/total : 0.0, spf, time_percent, zone.reportCalls, stats.min, stats.avg, stats.p99);
+			zone.reportNanos = 0;
+			zone.reportCalls = 0;
 		}
 		log::info("{}", report);
 
-		Profilers::GetSingleton().totalTime.Reset();
+		auto& debug = Config::GetSingleton().GetDebug();
+		if (debug.ShouldExportProfileCsv()) {
+			WriteCsv(historyFrames);
+		}
+		if (debug.ShouldExportProfileTrace()) {
+			WriteTrace();
+		}
 
-		last_report_frame = current_report_frame;
+		state.reportFrames = 0;
 		last_report_time = current_report_time;
 	}
-
-	Profilers& Profilers::GetSingleton() {
-		static Profilers instance;
-		return instance;
-	}
 }
@@ -1,56 +1,60 @@
 #pragma once
+// Per frame profiler
+//  Zones are registered on first use and identified by an integer id after that
+//  Zones nest (per thread) and can be recorded from any thread (main, havok, papyrus)
+//  The last HISTORY_FRAMES frames of every zone are kept for min/avg/p99
 
 namespace Gts {
-	class Profiler {
-		private:
-			// Type aliases to make accessing nested type easier
-			using Clock = std::chrono::steady_clock;
-			using Second = std::chrono::duration<double, std::ratio<1> >;
-
-			std::chrono::time_point<Clock> m_beg { Clock::now() };
-
-			double elapsed = 0.0;
-
-			std::string name = "";
-
-			bool running = false;
+	using ProfilerZoneId = std::uint32_t;
 
+	// Keep these static at the call site so the name is only looked up once
+	//   static ProfilerZone zone("Manager: Update()");
+	//   auto profiler = Profilers::Profile(zone);
+	class ProfilerZone {
 		public:
-			Profiler(std::string_view name);
-
-			void Start();
-
-			void Stop();
-
-			void Reset();
-
-			double Elapsed();
-
-			bool IsRunning();
-
-			double RunningTime();
-
-			std::string GetName();
+			explicit ProfilerZone(std::string_view name);
+			// Registered the first time it is needed while profiling is enabled
+			ProfilerZoneId GetId() const;
+		private:
+			std::string name;
+			mutable std::atomic<ProfilerZoneId> id;
 	};
 
 	class ProfilerHandle {
 		public:
-			ProfilerHandle(std::string_view name);
+			ProfilerHandle(ProfilerZoneId zone);
 			~ProfilerHandle();
+
+			ProfilerHandle(const ProfilerHandle&) = delete;
+			ProfilerHandle& operator=(const ProfilerHandle&) = delete;
 		private:
-			std::string name;
+			ProfilerZoneId zone;
+			bool started;
 	};
 
 	class Profilers {
 		public:
+			static constexpr ProfilerZoneId INVALID_ZONE = std::numeric_limits<ProfilerZoneId>::max();
+			static constexpr std::size_t MAX_ZONES = 1024;
+			static constexpr std::size_t HISTORY_FRAMES = 256;
+			static constexpr std::size_t MAX_TRACE_EVENTS = 65536;
+
 			[[nodiscard]] static ProfilerHandle Profile(std::string_view name);
+			[[nodiscard]] static ProfilerHandle Profile(const ProfilerZone& zone);
+
+			// Returns INVALID_ZONE if all MAX_ZONES are in use
+			static ProfilerZoneId Register(std::string_view name);
+			// Does not register, INVALID_ZONE if the name was never registered
+			static ProfilerZoneId Find(std::string_view name);
+
 			static void Start(std::string_view name);
 			static void Stop(std::string_view name);
+			static bool Start(ProfilerZoneId zone);
+			static void Stop(ProfilerZoneId zone);
+
+			// Closes the current frame, called once per main update
+			static void EndFrame();
+			// Logs the zones and writes the csv/trace files if enabled in the config
 			static void Report();
-		private:
-			bool AnyRunning();
-			[[nodiscard]] static Profilers& GetSingleton();
-			std::unordered_map<std::string,Profiler> profilers;
-			Profiler totalTime = Profiler("TotalTime"sv);
 	};
 }
@@ -11,7 +11,7 @@ using namespace RE;
 
 namespace Gts {
 
-	std::optional<std::filesystem::path> log_directory() {
+	inline std::optional<std::filesystem::path> log_directory() {
 		wchar_t* buffer{ nullptr };
 		const auto result = ::SHGetKnownFolderPath(::FOLDERID_Documents, ::KNOWN_FOLDER_FLAG::KF_FLAG_DEFAULT, nullptr, std::addressof(buffer));
 		std::unique_ptr<wchar_t[], decltype(&::CoTaskMemFree)> knownPath(buffer, ::CoTaskMemFree);
@@ -1,88 +1,267 @@
 #include "spring.hpp"
+#include "utils/smooth.hpp"
 #include "data/time.hpp"
 
-namespace {
-	// Spring code from https://theorangeduck.com/page/spring-roll-call
-	float halflife_to_damping(float halflife, float eps = 1e-5f)
-	{
-		return (4.0f * 0.69314718056f) / (halflife + eps);
+namespace Gts {
+
+	float Spring::GetValue() const {
+		return SpringManager::GetValue(this->handle);
+	}
+	float Spring::GetTarget() const {
+		return SpringManager::GetTarget(this->handle);
+	}
+	float Spring::GetVelocity() const {
+		return SpringManager::GetVelocity(this->handle);
+	}
+	float Spring::GetHalfLife() const {
+		return SpringManager::GetHalfLife(this->handle);
 	}
 
-	float damping_to_halflife(float damping, float eps = 1e-5f)
-	{
-		return (4.0f * 0.69314718056f) / (damping + eps);
+	void Spring::SetValue(float value) {
+		SpringManager::SetValue(this->handle, value);
 	}
-	float fast_negexp(float x)
-	{
-		return 1.0f / (1.0f + x + 0.48f*x*x + 0.235f*x*x*x);
+	void Spring::SetTarget(float target) {
+		SpringManager::SetTarget(this->handle, target);
+	}
+	void Spring::SetVelocity(float velocity) {
+		SpringManager::SetVelocity(this->handle, velocity);
+	}
+	void Spring::SetHalfLife(float halflife) {
+		SpringManager::SetHalfLife(this->handle, halflife);
 	}
-}
 
-namespace Gts {
+	Spring::Spring() : handle(SpringManager::AddSpring(0.0f, 0.0f, 0.0f, 1.0f)) {
+	}
 
-	void SpringBase::UpdateValues(float& value, const float& target, float & velocity, const float& halflife, const float& dt) {
-		if (std::isinf(target)) {
-			return;
-		}
-		if (fabs(target - value) < 1e-4 && velocity < 1e-4) {
-			return;
-		}
-		float y = halflife_to_damping(halflife) / 2.0f;
-		float j0 = value - target;
-		float j1 = velocity + j0*y;
-		float eydt = fast_negexp(y*dt);
+	Spring::Spring(float initial, float halflife) : handle(SpringManager::AddSpring(initial, initial, 0.0f, halflife)) {
+	}
 
-		value = eydt*(j0 + j1*dt) + target;
-		velocity = eydt*(velocity - j1*y*dt);
+	Spring::Spring(const Spring& other) : handle(SpringManager::AddSpring(other.GetValue(), other.GetTarget(), other.GetVelocity(), other.GetHalfLife())) {
 	}
 
-	void Spring::Update(float dt) {
-		UpdateValues(this->value, this->target, this->velocity, this->halflife, dt);
+	Spring::Spring(Spring&& other) noexcept : handle(other.handle) {
+		other.handle = SpringHandle();
 	}
 
-	Spring::Spring() {
-		SpringManager::AddSpring(this);
+	Spring& Spring::operator=(const Spring& other) {
+		if (this != &other) {
+			this->SetValue(other.GetValue());
+			this->SetTarget(other.GetTarget());
+			this->SetVelocity(other.GetVelocity());
+			this->SetHalfLife(other.GetHalfLife());
+		}
+		return *this;
 	}
 
-	Spring::Spring(float initial, float halflife) : value(initial), target(initial), halflife(halflife) {
-		SpringManager::AddSpring(this);
+	Spring& Spring::operator=(Spring&& other) noexcept {
+		if (this != &other) {
+			SpringManager::RemoveSpring(this->handle);
+			this->handle = other.handle;
+			other.handle = SpringHandle();
+		}
+		return *this;
 	}
 
 	Spring::~Spring() {
-		SpringManager::RemoveSpring(this);
+		SpringManager::RemoveSpring(this->handle);
 	}
 
 
 
-	void Spring3::Update(float dt) {
-		UpdateValues(this->value.x, this->target.x, this->velocity.x, this->halflife, dt);
-		UpdateValues(this->value.y, this->target.y, this->velocity.y, this->halflife, dt);
-		UpdateValues(this->value.z, this->target.z, this->velocity.z, this->halflife, dt);
+	NiPoint3 Spring3::GetValue() const {
+		return NiPoint3(this->x.GetValue(), this->y.GetValue(), this->z.GetValue());
+	}
+	NiPoint3 Spring3::GetTarget() const {
+		return NiPoint3(this->x.GetTarget(), this->y.GetTarget(), this->z.GetTarget());
+	}
+	NiPoint3 Spring3::GetVelocity() const {
+		return NiPoint3(this->x.GetVelocity(), this->y.GetVelocity(), this->z.GetVelocity());
+	}
+	float Spring3::GetHalfLife() const {
+		return this->x.GetHalfLife();
+	}
+
+	void Spring3::SetValue(const NiPoint3& value) {
+		this->x.SetValue(value.x);
+		this->y.SetValue(value.y);
+		this->z.SetValue(value.z);
+	}
+	void Spring3::SetTarget(const NiPoint3& target) {
+		this->x.SetTarget(target.x);
+		this->y.SetTarget(target.y);
+		this->z.SetTarget(target.z);
+	}
+	void Spring3::SetVelocity(const NiPoint3& velocity) {
+		this->x.SetVelocity(velocity.x);
+		this->y.SetVelocity(velocity.y);
+		this->z.SetVelocity(velocity.z);
+	}
+	void Spring3::SetHalfLife(float halflife) {
+		this->x.SetHalfLife(halflife);
+		this->y.SetHalfLife(halflife);
+		this->z.SetHalfLife(halflife);
 	}
 
 	Spring3::Spring3() {
-		SpringManager::AddSpring(this);
 	}
 
-	Spring3::Spring3(NiPoint3 initial, float halflife) : value(initial), target(initial), halflife(halflife) {
-		SpringManager::AddSpring(this);
+	Spring3::Spring3(NiPoint3 initial, float halflife) : x(initial.x, halflife), y(initial.y, halflife), z(initial.z, halflife) {
 	}
 
-	Spring3::~Spring3() {
-		SpringManager::RemoveSpring(this);
+
+
+	void SpringBatch::Add(float& value, float& velocity, float target, float halflife) {
+		this->valueRefs.push_back(&value);
+		this->velocityRefs.push_back(&velocity);
+		this->values.push_back(value);
+		this->velocities.push_back(velocity);
+		this->targets.push_back(target);
+		this->halflifes.push_back(halflife);
+	}
+
+	void SpringBatch::Solve(float dt) {
+		critically_damped_batch(this->values.data(), this->velocities.data(), this->targets.data(), this->halflifes.data(), this->values.size(), dt);
+		for (std::size_t i = 0; i < this->values.size(); i++) {
+			*this->valueRefs[i] = this->values[i];
+			*this->velocityRefs[i] = this->velocities[i];
+		}
+		this->valueRefs.clear();
+		this->velocityRefs.clear();
+		this->values.clear();
+		this->velocities.clear();
+		this->targets.clear();
+		this->halflifes.clear();
 	}
 
 
+
 	SpringManager& SpringManager::GetSingleton() {
 		static SpringManager instance;
 		return instance;
 	}
 
-	void SpringManager::AddSpring(SpringBase* spring)  {
-		SpringManager::GetSingleton().springs.insert(spring);
+	SpringHandle SpringManager::AddSpring(float value, float target, float velocity, float halflife) {
+		auto& me = SpringManager::GetSingleton();
+		SpringHandle handle;
+		if (!me.freeHandles.empty()) {
+			handle.id = me.freeHandles.back();
+			me.freeHandles.pop_back();
+		} else {
+			handle.id = static_cast<std::uint32_t>(me.lanes.size());
+			me.lanes.push_back(0);
+		}
+
+		std::uint32_t lane = static_cast<std::uint32_t>(me.values.size());
+		me.values.push_back(value);
+		me.targets.push_back(target);
+		me.velocities.push_back(velocity);
+		me.halflifes.push_back(halflife);
+		me.owners.push_back(handle.id);
+		me.lanes[handle.id] = lane;
+		me.Wake(lane);
+		return handle;
+	}
+
+	void SpringManager::RemoveSpring(SpringHandle& handle) {
+		if (!handle.IsValid()) {
+			return;
+		}
+		auto& me = SpringManager::GetSingleton();
+		std::uint32_t lane = me.lanes[handle.id];
+		me.Sleep(lane);
+		lane = me.lanes[handle.id];
+		std::uint32_t last = static_cast<std::uint32_t>(me.values.size() - 1);
+		me.SwapLanes(lane, last);
+
+		me.values.pop_back();
+		me.targets.pop_back();
+		me.velocities.pop_back();
+		me.halflifes.pop_back();
+		me.owners.pop_back();
+		me.freeHandles.push_back(handle.id);
+		handle = SpringHandle();
+	}
+
+	float SpringManager::GetValue(const SpringHandle& handle) {
+		auto& me = SpringManager::GetSingleton();
+		return me.values[me.lanes[handle.id]];
+	}
+	float SpringManager::GetTarget(const SpringHandle& handle) {
+		auto& me = SpringManager::GetSingleton();
+		return me.targets[me.lanes[handle.id]];
+	}
+	float SpringManager::GetVelocity(const SpringHandle& handle) {
+		auto& me = SpringManager::GetSingleton();
+		return me.velocities[me.lanes[handle.id]];
+	}
+	float SpringManager::GetHalfLife(const SpringHandle& handle) {
+		auto& me = SpringManager::GetSingleton();
+		return me.halflifes[me.lanes[handle.id]];
+	}
+
+	void SpringManager::SetValue(const SpringHandle& handle, float value) {
+		auto& me = SpringManager::GetSingleton();
+		std::uint32_t lane = me.lanes[handle.id];
+		if (me.values[lane] != value) {
+			me.values[lane] = value;
+			me.Wake(lane);
+		}
+	}
+	void SpringManager::SetTarget(const SpringHandle& handle, float target) {
+		auto& me = SpringManager::GetSingleton();
+		std::uint32_t lane = me.lanes[handle.id];
+		if (me.targets[lane] != target) {
+			me.targets[lane] = target;
+			me.Wake(lane);
+		}
+	}
+	void SpringManager::SetVelocity(const SpringHandle& handle, float velocity) {
+		auto& me = SpringManager::GetSingleton();
+		std::uint32_t lane = me.lanes[handle.id];
+		if (me.velocities[lane] != velocity) {
+			me.velocities[lane] = velocity;
+			me.Wake(lane);
+		}
+	}
+	void SpringManager::SetHalfLife(const SpringHandle& handle, float halflife) {
+		auto& me = SpringManager::GetSingleton();
+		std::uint32_t lane = me.lanes[handle.id];
+		me.halflifes[lane] = halflife;
+	}
+
+	void SpringManager::SwapLanes(std::uint32_t a, std::uint32_t b) {
+		if (a == b) {
+			return;
+		}
+		std::swap(this->values[a], this->values[b]);
+		std::swap(this->targets[a], this->targets[b]);
+		std::swap(this->velocities[a], this->velocities[b]);
+		std::swap(this->halflifes[a], this->halflifes[b]);
+		std::swap(this->owners[a], this->owners[b]);
+		this->lanes[this->owners[a]] = a;
+		this->lanes[this->owners[b]] = b;
 	}
-	void SpringManager::RemoveSpring(SpringBase* spring) {
-		SpringManager::GetSingleton().springs.erase(spring);
+
+	void SpringManager::Wake(std::uint32_t lane) {
+		if (lane >= this->awake) {
+			this->SwapLanes(lane, this->awake);
+			this->awake += 1;
+		}
+	}
+
+	void SpringManager::Sleep(std::uint32_t lane) {
+		if (lane < this->awake) {
+			this->awake -= 1;
+			this->SwapLanes(lane, this->awake);
+		}
+	}
+
+	bool SpringManager::IsSettled(std::uint32_t lane) const {
+		float target = this->targets[lane];
+		if (std::isinf(target)) {
+			return true;
+		}
+		return fabs(target - this->values[lane]) < 1e-4 && this->velocities[lane] < 1e-4;
 	}
 
 	std::string SpringManager::DebugName()  {
@@ -90,10 +269,17 @@ namespace Gts {
 	}
 
 	void SpringManager::Update() {
-		float dt = Time::WorldTimeDelta();
-		for (auto spring: this->springs) {
-			spring->Update(dt);
+		// Settled springs would not move this frame, they sleep until a value is changed
+		for (std::uint32_t lane = 0; lane < this->awake;) {
+			if (this->IsSettled(lane)) {
+				this->Sleep(lane);
+			} else {
+				lane += 1;
+			}
 		}
-		// log::info("Spring manager updated: {} spring", this->springs.size());
+
+		float dt = Time::WorldTimeDelta();
+		critically_damped_batch(this->values.data(), this->velocities.data(), this->targets.data(), this->halflifes.data(), this->awake, dt);
+		// log::info("Spring manager updated: {} of {} spring", this->awake, this->values.size());
 	}
 }
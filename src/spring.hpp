@@ -1,58 +1,120 @@
 #pragma once
 // Critically Damped Springs
 //
+//  The state of every spring lives in SpringManager as structure of arrays and is
+//  integrated in one batched pass. Spring/Spring3 only own a handle to their lanes.
+//  Springs that have converged (or have an infinite target) are put to sleep and
+//  are woken up again when any of their values is changed.
 #include "events.hpp"
 
 using namespace SKSE;
 
 namespace Gts {
-	class SpringBase {
-		public:
-			virtual void Update(float delta) = 0;
-		protected:
-			void UpdateValues(float& value, const float& target, float & velocity, const float& halflife, const float& dt);
+	struct SpringHandle {
+		static constexpr std::uint32_t INVALID = std::numeric_limits<std::uint32_t>::max();
+		std::uint32_t id = INVALID;
+
+		bool IsValid() const {
+			return this->id != INVALID;
+		}
 	};
 
-	class Spring : public SpringBase {
+	class Spring {
 		public:
-			float value = 0.0f;
-			float target = 0.0f;
-			float velocity = 0.0f;
-			float halflife = 1.0f;
+			float GetValue() const;
+			float GetTarget() const;
+			float GetVelocity() const;
+			float GetHalfLife() const;
 
-			void Update(float delta) override;
+			void SetValue(float value);
+			void SetTarget(float target);
+			void SetVelocity(float velocity);
+			void SetHalfLife(float halflife);
 
 			Spring();
 			Spring(float initial, float halflife);
+			Spring(const Spring& other);
+			Spring(Spring&& other) noexcept;
+			Spring& operator=(const Spring& other);
+			Spring& operator=(Spring&& other) noexcept;
 
 			~Spring();
+		private:
+			SpringHandle handle;
 	};
 
-	class Spring3 : public SpringBase {
+	class Spring3 {
 		public:
-			NiPoint3 value = NiPoint3(0.0f, 0.0f, 0.0f);
-			NiPoint3 target = NiPoint3(0.0f, 0.0f, 0.0f);
-			NiPoint3 velocity = NiPoint3(0.0f, 0.0f, 0.0f);
-			float halflife = 1.0f;
+			NiPoint3 GetValue() const;
+			NiPoint3 GetTarget() const;
+			NiPoint3 GetVelocity() const;
+			float GetHalfLife() const;
 
-			void Update(float delta) override;
+			void SetValue(const NiPoint3& value);
+			void SetTarget(const NiPoint3& target);
+			void SetVelocity(const NiPoint3& velocity);
+			void SetHalfLife(float halflife);
 
 			Spring3();
 			Spring3(NiPoint3 initial, float halflife);
+		private:
+			Spring x;
+			Spring y;
+			Spring z;
+	};
 
-			~Spring3();
+	// One off springs that are stepped together (e.g. the scale of every actor)
+	//  Add() keeps a pointer to value/velocity, they must stay valid until Solve()
+	class SpringBatch {
+		public:
+			void Add(float& value, float& velocity, float target, float halflife);
+			// Steps every added spring by dt, writes the results back and clears the batch
+			void Solve(float dt);
+		private:
+			std::vector<float*> valueRefs;
+			std::vector<float*> velocityRefs;
+			std::vector<float> values;
+			std::vector<float> velocities;
+			std::vector<float> targets;
+			std::vector<float> halflifes;
 	};
 
 	class SpringManager : public EventListener {
 		public:
 			static SpringManager& GetSingleton();
 
-			static void AddSpring(SpringBase* spring);
-			static void RemoveSpring(SpringBase* spring);
+			static SpringHandle AddSpring(float value, float target, float velocity, float halflife);
+			static void RemoveSpring(SpringHandle& handle);
+
+			static float GetValue(const SpringHandle& handle);
+			static float GetTarget(const SpringHandle& handle);
+			static float GetVelocity(const SpringHandle& handle);
+			static float GetHalfLife(const SpringHandle& handle);
+
+			static void SetValue(const SpringHandle& handle, float value);
+			static void SetTarget(const SpringHandle& handle, float target);
+			static void SetVelocity(const SpringHandle& handle, float velocity);
+			static void SetHalfLife(const SpringHandle& handle, float halflife);
 
 			virtual std::string DebugName() override;
 			virtual void Update() override;
 
-			std::unordered_set<SpringBase*> springs;
+		private:
+			void SwapLanes(std::uint32_t a, std::uint32_t b);
+			void Wake(std::uint32_t lane);
+			void Sleep(std::uint32_t lane);
+			bool IsSettled(std::uint32_t lane) const;
+
+			// Indexed by lane, lanes [0, awake) are integrated, the rest are asleep
+			std::vector<float> values;
+			std::vector<float> targets;
+			std::vector<float> velocities;
+			std::vector<float> halflifes;
+			std::vector<std::uint32_t> owners;
+			std::uint32_t awake = 0;
+
+			// Indexed by handle id
+			std::vector<std::uint32_t> lanes;
+			std::vector<std::uint32_t> freeHandles;
 	};
 }
@@ -0,0 +1,186 @@
+#include "utils/ActorGrid.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "utils/actorUtils.hpp"
+#include "utils/findActor.hpp"
+#include "scale/scale.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	// ~15m cells, roughly the idle foot check range of a x5 giant
+	const float CELL_SIZE = 1024.0f;
+}
+
+namespace Gts {
+	ActorGrid& ActorGrid::GetSingleton() noexcept {
+		static ActorGrid instance;
+		return instance;
+	}
+
+	std::string ActorGrid::DebugName() {
+		return "ActorGrid";
+	}
+
+	void ActorGrid::Reset() {
+		this->entries.clear();
+		this->sorted.clear();
+		this->cells.clear();
+		this->builtFrame = std::numeric_limits<std::uint64_t>::max();
+	}
+
+	void ActorGrid::ResetActor(Actor* actor) {
+		// Rebuilding here would free entries that outer loops are still iterating, and would
+		// read the same frame-frozen registry anyway, so only the entry is marked dead
+		if (!actor) {
+			return;
+		}
+		for (auto& entry: this->entries) {
+			if (entry.actor == actor) {
+				entry.actor = nullptr;
+			}
+		}
+	}
+
+	std::int64_t ActorGrid::CellCoord(float value) {
+		return static_cast<std::int64_t>(std::floor(value / CELL_SIZE));
+	}
+
+	std::uint64_t ActorGrid::CellKey(std::int64_t x, std::int64_t y) {
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+	}
+
+	void ActorGrid::EnsureBuilt() {
+		std::uint64_t frame = Time::FramesElapsed();
+		if (this->builtFrame != frame) {
+			this->Rebuild();
+			this->builtFrame = frame;
+		}
+	}
+
+	void ActorGrid::Rebuild() {
+		auto profiler = Profilers::Profile("ActorGrid: Rebuild");
+		this->entries.clear();
+		this->sorted.clear();
+		this->cells.clear();
+
+		for (auto actor: ActorRegistry::Actors()) {
+			if (actor) {
+				this->entries.push_back(ActorGridEntry {
+					.actor = actor,
+					.position = actor->GetPosition(),
+					.scale = get_visual_scale(actor) * GetSizeFromBoundingBox(actor),
+				});
+			}
+		}
+
+		std::vector<std::uint64_t> keys;
+		keys.reserve(this->entries.size());
+		for (auto& entry: this->entries) {
+			keys.push_back(CellKey(CellCoord(entry.position.x), CellCoord(entry.position.y)));
+		}
+
+		this->sorted.resize(this->entries.size());
+		std::iota(this->sorted.begin(), this->sorted.end(), 0);
+		std::sort(this->sorted.begin(), this->sorted.end(), [&keys](std::uint32_t a, std::uint32_t b) {
+			return keys[a] < keys[b];
+		});
+
+		for (std::uint32_t i = 0; i < this->sorted.size(); i++) {
+			auto key = keys[this->sorted[i]];
+			auto [it, inserted] = this->cells.try_emplace(key, i, 0);
+			it->second.second += 1;
+		}
+	}
+
+	std::vector<const ActorGridEntry*> ActorGrid::Query(const NiPoint3& center, float radius) {
+		auto profiler = Profilers::Profile("ActorGrid: Query");
+		if (!ActorRegistry::OnRegistryThread()) {
+			// The grid is only built and read on the main thread, same as the registry it is built from
+			static std::once_flag warned;
+			std::call_once(warned, [] {
+				log::warn("ActorGrid: Query called off the main thread, scanning all actors");
+			});
+			return ActorGrid::QueryOffThread(center, radius);
+		}
+		auto& me = ActorGrid::GetSingleton();
+		me.EnsureBuilt();
+
+		std::vector<const ActorGridEntry*> result;
+		float radiusSq = radius * radius;
+		auto test = [&](const ActorGridEntry& entry) {
+			if (!entry.actor) {
+				return;
+			}
+			NiPoint3 delta = entry.position - center;
+			if (delta.x * delta.x + delta.y * delta.y + delta.z * delta.z <= radiusSq) {
+				result.push_back(&entry);
+			}
+		};
+
+		std::int64_t minX = CellCoord(center.x - radius);
+		std::int64_t maxX = CellCoord(center.x + radius);
+		std::int64_t minY = CellCoord(center.y - radius);
+		std::int64_t maxY = CellCoord(center.y + radius);
+		std::uint64_t cellCount = static_cast<std::uint64_t>(maxX - minX + 1) * static_cast<std::uint64_t>(maxY - minY + 1);
+
+		if (cellCount >= me.cells.size()) {
+			// Huge radius (very big giants), walking the occupied cells is cheaper
+			for (auto& entry: me.entries) {
+				test(entry);
+			}
+			return result;
+		}
+
+		for (std::int64_t x = minX; x <= maxX; x++) {
+			for (std::int64_t y = minY; y <= maxY; y++) {
+				auto found = me.cells.find(CellKey(x, y));
+				if (found != me.cells.end()) {
+					auto [start, count] = found->second;
+					for (std::uint32_t i = start; i < start + count; i++) {
+						test(me.entries[me.sorted[i]]);
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	std::vector<const ActorGridEntry*> ActorGrid::QueryOffThread(const NiPoint3& center, float radius) {
+		// Kept for the frame so the returned pointers outlive nested queries on this thread
+		thread_local std::deque<ActorGridEntry> scratch;
+		thread_local std::uint64_t scratchFrame = std::numeric_limits<std::uint64_t>::max();
+		std::uint64_t frame = Time::FramesElapsed();
+		if (scratchFrame != frame) {
+			scratch.clear();
+			scratchFrame = frame;
+		}
+
+		std::vector<const ActorGridEntry*> result;
+		float radiusSq = radius * radius;
+		for (auto actor: find_actors()) {
+			NiPoint3 position = actor->GetPosition();
+			NiPoint3 delta = position - center;
+			if (delta.x * delta.x + delta.y * delta.y + delta.z * delta.z <= radiusSq) {
+				result.push_back(&scratch.emplace_back(ActorGridEntry {
+					.actor = actor,
+					.position = position,
+					.scale = get_visual_scale(actor) * GetSizeFromBoundingBox(actor),
+				}));
+			}
+		}
+		return result;
+	}
+
+	std::vector<Actor*> ActorGrid::FindActorsInRange(const NiPoint3& center, float radius) {
+		std::vector<Actor*> result;
+		for (auto entry: ActorGrid::Query(center, radius)) {
+			result.push_back(entry->actor);
+		}
+		return result;
+	}
+}
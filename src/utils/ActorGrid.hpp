@@ -0,0 +1,48 @@
+#pragma once
+// Module that keeps a per-frame spatial hash of loaded actors
+//  Used as a broadphase for collision/proximity checks so they don't have to scan every loaded actor
+#include "events.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+
+	struct ActorGridEntry {
+		// nullptr once the actor was reset during the frame, Query skips those
+		Actor* actor;
+		NiPoint3 position;
+		// get_visual_scale * GetSizeFromBoundingBox
+		float scale;
+	};
+
+	class ActorGrid : public EventListener {
+		public:
+			[[nodiscard]] static ActorGrid& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+
+			// All actors whose position is within radius of the center
+			// The grid is rebuilt on the first query of each frame, the entries stay valid until the next frame
+			// Off the main thread the actors are scanned without the grid, those entries are valid until the next frame on that thread
+			static std::vector<const ActorGridEntry*> Query(const NiPoint3& center, float radius);
+			// Same as above but only the actors
+			static std::vector<Actor*> FindActorsInRange(const NiPoint3& center, float radius);
+
+		private:
+			void Rebuild();
+			void EnsureBuilt();
+			static std::vector<const ActorGridEntry*> QueryOffThread(const NiPoint3& center, float radius);
+			static std::int64_t CellCoord(float value);
+			static std::uint64_t CellKey(std::int64_t x, std::int64_t y);
+
+			std::vector<ActorGridEntry> entries;
+			// Entries sorted by cell, each cell owns a contiguous [start, start + count) range
+			std::vector<std::uint32_t> sorted;
+			std::unordered_map<std::uint64_t, std::pair<std::uint32_t, std::uint32_t>> cells;
+			std::uint64_t builtFrame = std::numeric_limits<std::uint64_t>::max();
+	};
+}
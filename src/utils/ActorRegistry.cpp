@@ -0,0 +1,121 @@
+#include "utils/ActorRegistry.hpp"
+#include "utils/actorUtils.hpp"
+#include "data/persistent.hpp"
+#include "data/transient.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace Gts {
+	ActorRegistry& ActorRegistry::GetSingleton() noexcept {
+		static ActorRegistry instance;
+		return instance;
+	}
+
+	std::string ActorRegistry::DebugName() {
+		return "ActorRegistry";
+	}
+
+	void ActorRegistry::Update() {
+		this->mainThread = std::this_thread::get_id();
+		this->EnsureFresh();
+	}
+
+	void ActorRegistry::Start() {
+		// First frame after a load, DoUpdate is not called on it
+		this->mainThread = std::this_thread::get_id();
+		this->refreshedFrame = std::numeric_limits<std::uint64_t>::max();
+		this->EnsureFresh();
+	}
+
+	void ActorRegistry::Reset() {
+		this->actors.clear();
+		this->records.clear();
+		this->lookup.clear();
+		this->generation += 1;
+		this->refreshedFrame = std::numeric_limits<std::uint64_t>::max();
+	}
+
+	void ActorRegistry::ResetActor(Actor* actor) {
+		// The actor may be deleted or unloaded before the next refresh, loops of this frame skip it
+		auto found = std::lower_bound(this->lookup.begin(), this->lookup.end(), actor);
+		if (actor && found != this->lookup.end() && *found == actor) {
+			std::size_t index = static_cast<std::size_t>(found - this->lookup.begin());
+			this->actors[index] = nullptr;
+			this->records[index].actor = nullptr;
+		}
+	}
+
+	std::span<Actor* const> ActorRegistry::Actors() {
+		auto& me = ActorRegistry::GetSingleton();
+		me.EnsureFresh();
+		return me.actors;
+	}
+
+	std::span<const ActorRecord> ActorRegistry::Records() {
+		auto& me = ActorRegistry::GetSingleton();
+		me.EnsureFresh();
+		return me.records;
+	}
+
+	const ActorRecord* ActorRegistry::GetRecord(Actor* actor) {
+		auto& me = ActorRegistry::GetSingleton();
+		me.EnsureFresh();
+		auto found = std::lower_bound(me.lookup.begin(), me.lookup.end(), actor);
+		if (!actor || found == me.lookup.end() || *found != actor) {
+			return nullptr;
+		}
+		auto& record = me.records[static_cast<std::size_t>(found - me.lookup.begin())];
+		return record.actor ? &record : nullptr;
+	}
+
+	std::uint64_t ActorRegistry::Generation() {
+		return ActorRegistry::GetSingleton().generation;
+	}
+
+	bool ActorRegistry::OnRegistryThread() {
+		return std::this_thread::get_id() == ActorRegistry::GetSingleton().mainThread;
+	}
+
+	void ActorRegistry::EnsureFresh() {
+		// Only ever rebuilt at the first access of a frame, so spans handed out stay valid for the whole frame
+		if (!ActorRegistry::OnRegistryThread()) {
+			return;
+		}
+		std::uint64_t frame = Time::FramesElapsed();
+		if (this->refreshedFrame != frame) {
+			this->Refresh();
+			this->refreshedFrame = frame;
+		}
+	}
+
+	void ActorRegistry::Refresh() {
+		auto profiler = Profilers::Profile("ActorRegistry: Refresh");
+		this->actors = find_actors_high();
+		std::sort(this->actors.begin(), this->actors.end());
+		this->actors.erase(std::unique(this->actors.begin(), this->actors.end()), this->actors.end());
+		this->lookup = this->actors;
+
+		auto& persistent = Persistent::GetSingleton();
+		auto& transient = Transient::GetSingleton();
+		this->records.clear();
+		this->records.reserve(this->actors.size());
+		for (auto actor: this->actors) {
+			this->records.push_back(ActorRecord {
+				.actor = actor,
+				.formID = actor->formID,
+				.isPlayer = actor->formID == 0x14,
+				.isTeammate = IsTeammate(actor),
+				.is3DLoaded = actor->Is3DLoaded(),
+				.isDead = actor->IsDead(),
+				.persistent = persistent.GetHandle(actor),
+				.transient = transient.GetHandle(actor),
+			});
+		}
+		this->generation += 1;
+	}
+}
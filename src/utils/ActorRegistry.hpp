@@ -0,0 +1,63 @@
+#pragma once
+// Module that keeps the list of loaded actors for the current frame
+//  Resolving actor handles is done once per frame here instead of in every find_actors() call
+#include "events.hpp"
+#include "data/slotmap.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+
+	// State of an actor cached at the time the registry was refreshed
+	struct ActorRecord {
+		Actor* actor;
+		FormID formID;
+		bool isPlayer;
+		bool isTeammate;
+		bool is3DLoaded;
+		bool isDead;
+		// Slots of the actor in Persistent/Transient, invalid if it had no data yet
+		SlotHandle persistent;
+		SlotHandle transient;
+	};
+
+	class ActorRegistry : public EventListener {
+		public:
+			[[nodiscard]] static ActorRegistry& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Start() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+
+			// Loaded actors (high process + player) sorted by pointer, same as find_actors()
+			// Only valid on the main thread until the next frame
+			// An actor reset during the frame is replaced by nullptr in both lists
+			static std::span<Actor* const> Actors();
+			static std::span<const ActorRecord> Records();
+			// nullptr if the actor was not loaded when the registry was refreshed
+			static const ActorRecord* GetRecord(Actor* actor);
+
+			// Incremented every time the actor list is rebuilt, compare against a stored
+			// value to know if data derived from the list is stale
+			static std::uint64_t Generation();
+
+			// True when called from the thread that refreshes the registry
+			static bool OnRegistryThread();
+
+		private:
+			void EnsureFresh();
+			void Refresh();
+
+			std::vector<Actor*> actors;
+			std::vector<ActorRecord> records;
+			// Same order as actors but never nulled, GetRecord/ResetActor search it
+			std::vector<Actor*> lookup;
+			std::uint64_t generation = 0;
+			std::uint64_t refreshedFrame = std::numeric_limits<std::uint64_t>::max();
+			std::thread::id mainThread;
+	};
+}
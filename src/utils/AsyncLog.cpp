@@ -0,0 +1,270 @@
+#include "utils/AsyncLog.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	const std::int64_t RATE_WINDOW_MS = 1000;
+	// How long the writer sleeps when the queue is empty
+	const auto WRITER_IDLE = std::chrono::milliseconds(2);
+
+	std::int64_t NowMs() {
+		auto now = std::chrono::steady_clock::now().time_since_epoch();
+		return std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+	}
+
+	std::uint64_t CallsiteKey(const spdlog::source_loc& source) {
+		// Source locations come from std::source_location so the file name is a literal with a stable address
+		// The line is mixed in before the multiply so the lines of one file spread over the table (FindCallsite uses the high bits)
+		// Shifted past the bits in which two literals of the plugin can differ, so two callsites never share a key
+		std::uint64_t key = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(source.filename)) ^ (static_cast<std::uint64_t>(source.line) << 40);
+		key *= 11400714819323198485ull;
+		return key == 0 ? 1 : key;
+	}
+}
+
+namespace Gts {
+	AsyncLogSink::AsyncLogSink(std::shared_ptr<spdlog::sinks::sink> target) : target(std::move(target)) {
+		this->entries = std::make_unique<Entry[]>(QUEUE_SIZE);
+		for (std::size_t i = 0; i < QUEUE_SIZE; i++) {
+			this->entries[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		this->callsites = std::make_unique<Callsite[]>(MAX_CALLSITES);
+		this->writer = std::jthread([this](std::stop_token stop) {
+			this->Run(stop);
+		});
+	}
+
+	AsyncLogSink::~AsyncLogSink() {
+		this->writer.request_stop();
+		if (this->writer.joinable()) {
+			this->writer.join();
+		}
+		// Writer is gone, this thread is the only consumer now
+		this->Drain();
+		this->target->flush();
+	}
+
+	void AsyncLogSink::log(const spdlog::details::log_msg& msg) {
+		if (!this->RateLimit(msg)) {
+			return;
+		}
+		this->Write(msg);
+	}
+
+	void AsyncLogSink::flush() {
+		if (this->async.load(std::memory_order_relaxed) && this->writer.joinable() && std::this_thread::get_id() != this->writer.get_id()) {
+			std::size_t pos = this->tail.load(std::memory_order_acquire);
+			while (this->head.load(std::memory_order_acquire) < pos) {
+				std::this_thread::yield();
+			}
+		}
+		this->target->flush();
+	}
+
+	void AsyncLogSink::set_pattern(const std::string& pattern) {
+		this->target->set_pattern(pattern);
+	}
+
+	void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter) {
+		this->target->set_formatter(std::move(formatter));
+	}
+
+	void AsyncLogSink::SetAsync(bool async) {
+		if (this->async.exchange(async) && !async) {
+			// Queued lines go out before the ones written directly from now on
+			std::size_t pos = this->tail.load(std::memory_order_acquire);
+			while (this->head.load(std::memory_order_acquire) < pos) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void AsyncLogSink::SetFlushLevel(spdlog::level::level_enum level) {
+		this->flushLevel.store(level, std::memory_order_relaxed);
+	}
+
+	void AsyncLogSink::SetRateLimit(std::uint32_t perSecond) {
+		this->rateLimit.store(perSecond, std::memory_order_relaxed);
+	}
+
+	bool AsyncLogSink::RateLimit(const spdlog::details::log_msg& msg) {
+		std::uint32_t limit = this->rateLimit.load(std::memory_order_relaxed);
+		if (limit == 0 || msg.source.empty() || msg.level >= spdlog::level::critical) {
+			return true;
+		}
+		Callsite* callsite = this->FindCallsite(msg);
+		if (!callsite) {
+			return true;
+		}
+
+		std::int64_t now = NowMs();
+		std::int64_t start = callsite->windowStart.load(std::memory_order_relaxed);
+		if (now - start >= RATE_WINDOW_MS) {
+			if (callsite->windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+				callsite->count.store(0, std::memory_order_relaxed);
+				this->ReportRepeats(*callsite);
+				start = now;
+			}
+			// else start now holds the window another thread just opened
+		}
+
+		// The same text again within a window (e.g. a miss logged every frame) only shows up in the
+		// repeat count, a line logged once per load is written every time
+		std::size_t hash = std::hash<std::string_view>{}(std::string_view(msg.payload.data(), msg.payload.size()));
+		std::size_t lastHash = callsite->lastHash.exchange(hash, std::memory_order_relaxed);
+		std::int64_t lastWindow = callsite->lastHashWindow.exchange(start, std::memory_order_relaxed);
+		if (lastHash == hash && lastWindow == start) {
+			callsite->repeated.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		if (callsite->count.fetch_add(1, std::memory_order_relaxed) >= limit) {
+			callsite->suppressed.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		return true;
+	}
+
+	AsyncLogSink::Callsite* AsyncLogSink::FindCallsite(const spdlog::details::log_msg& msg) {
+		const auto& source = msg.source;
+		std::uint64_t key = CallsiteKey(source);
+		std::size_t index = static_cast<std::size_t>(key >> 32);
+		for (std::size_t i = 0; i < MAX_CALLSITES; i++) {
+			Callsite& callsite = this->callsites[(index + i) & (MAX_CALLSITES - 1)];
+			std::uint64_t existing = callsite.key.load(std::memory_order_acquire);
+			if (existing == 0 && callsite.key.compare_exchange_strong(existing, key, std::memory_order_acq_rel)) {
+				callsite.filename.store(source.filename, std::memory_order_relaxed);
+				callsite.funcname.store(source.funcname, std::memory_order_relaxed);
+				callsite.line.store(source.line, std::memory_order_relaxed);
+				callsite.level.store(msg.level, std::memory_order_relaxed);
+				return &callsite;
+			}
+			if (existing == key) {
+				return &callsite;
+			}
+		}
+		// Table is full, the remaining callsites are not limited
+		return nullptr;
+	}
+
+	void AsyncLogSink::ReportRepeats(Callsite& callsite) {
+		std::uint32_t repeated = callsite.repeated.exchange(0, std::memory_order_relaxed);
+		std::uint32_t suppressed = callsite.suppressed.exchange(0, std::memory_order_relaxed);
+		if (repeated == 0 && suppressed == 0) {
+			return;
+		}
+		std::string text;
+		if (suppressed == 0) {
+			text = fmt::format("message repeated {} times", repeated);
+		} else {
+			text = fmt::format("{} more messages suppressed ({} repeats)", repeated + suppressed, repeated);
+		}
+		spdlog::source_loc source(callsite.filename.load(std::memory_order_relaxed), callsite.line.load(std::memory_order_relaxed), callsite.funcname.load(std::memory_order_relaxed));
+		auto level = static_cast<spdlog::level::level_enum>(callsite.level.load(std::memory_order_relaxed));
+		this->Write(spdlog::details::log_msg(source, "", level, text));
+	}
+
+	void AsyncLogSink::Write(const spdlog::details::log_msg& msg) {
+		if (!this->async.load(std::memory_order_relaxed)) {
+			this->target->log(msg);
+			if (msg.level >= this->flushLevel.load(std::memory_order_relaxed)) {
+				this->target->flush();
+			}
+			return;
+		}
+		if (!this->Push(msg)) {
+			// Never wait on the writer, the count is reported once there is room again
+			this->dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	bool AsyncLogSink::Push(const spdlog::details::log_msg& msg) {
+		std::size_t pos = this->tail.load(std::memory_order_relaxed);
+		while (true) {
+			Entry& entry = this->entries[pos & (QUEUE_SIZE - 1)];
+			std::size_t sequence = entry.sequence.load(std::memory_order_acquire);
+			auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0) {
+				if (this->tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					entry.time = msg.time;
+					entry.source = msg.source;
+					entry.loggerName = msg.logger_name;
+					entry.level = msg.level;
+					entry.threadId = msg.thread_id;
+					entry.length = msg.payload.size();
+					if (entry.length <= MAX_LINE) {
+						std::memcpy(entry.text.data(), msg.payload.data(), entry.length);
+					} else {
+						entry.longText.assign(msg.payload.data(), msg.payload.size());
+					}
+					entry.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (diff < 0) {
+				// The writer has not freed this slot yet
+				return false;
+			} else {
+				pos = this->tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	std::size_t AsyncLogSink::Drain() {
+		std::size_t written = 0;
+		bool flush = false;
+		int flushAt = this->flushLevel.load(std::memory_order_relaxed);
+		while (true) {
+			std::size_t pos = this->head.load(std::memory_order_relaxed);
+			Entry& entry = this->entries[pos & (QUEUE_SIZE - 1)];
+			if (entry.sequence.load(std::memory_order_acquire) != pos + 1) {
+				break;
+			}
+			const char* text = entry.length <= MAX_LINE ? entry.text.data() : entry.longText.data();
+			spdlog::details::log_msg msg(entry.time, entry.source, entry.loggerName, entry.level, spdlog::string_view_t(text, entry.length));
+			msg.thread_id = entry.threadId;
+			this->target->log(msg);
+			flush |= entry.level >= flushAt;
+			if (entry.length > MAX_LINE) {
+				entry.longText = std::string();
+			}
+
+			entry.sequence.store(pos + QUEUE_SIZE, std::memory_order_release);
+			this->head.store(pos + 1, std::memory_order_release);
+			written += 1;
+		}
+
+		std::size_t dropped = this->dropped.exchange(0, std::memory_order_relaxed);
+		if (dropped > 0) {
+			auto text = fmt::format("{} log lines were dropped, the log queue was full", dropped);
+			this->target->log(spdlog::details::log_msg(spdlog::source_loc(), "", spdlog::level::warn, text));
+			flush = true;
+		}
+		if (flush) {
+			this->target->flush();
+		}
+		return written;
+	}
+
+	void AsyncLogSink::Run(std::stop_token stop) {
+		std::int64_t lastSweep = NowMs();
+		while (!stop.stop_requested()) {
+			if (this->Drain() == 0) {
+				std::this_thread::sleep_for(WRITER_IDLE);
+			}
+
+			// Callsites that went quiet still report what they suppressed
+			std::int64_t now = NowMs();
+			if (now - lastSweep >= RATE_WINDOW_MS) {
+				lastSweep = now;
+				for (std::size_t i = 0; i < MAX_CALLSITES; i++) {
+					Callsite& callsite = this->callsites[i];
+					if (callsite.key.load(std::memory_order_acquire) != 0 && now - callsite.windowStart.load(std::memory_order_relaxed) >= RATE_WINDOW_MS) {
+						this->ReportRepeats(callsite);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+// spdlog sink that moves the file writes off the calling thread
+//  Lines are copied into a fixed lock-free ring and written/flushed by a background thread
+//  Each callsite (file:line) may log RATE_LIMIT lines per second, repeats of the same text and
+//  lines above the limit are counted and reported as "message repeated N times"
+//  Errors still block until they are on disk so nothing is lost before a crash
+#include <spdlog/sinks/sink.h>
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+// Trace/debug calls are compiled out below SPDLOG_ACTIVE_LEVEL (info in release builds),
+// their arguments are not evaluated either
+#define GTS_LOG_TRACE(...) do { if constexpr (SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE) { SKSE::log::trace(__VA_ARGS__); } } while (0)
+#define GTS_LOG_DEBUG(...) do { if constexpr (SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG) { SKSE::log::debug(__VA_ARGS__); } } while (0)
+
+namespace Gts {
+	class AsyncLogSink : public spdlog::sinks::sink {
+		public:
+			// Power of two
+			static constexpr std::size_t QUEUE_SIZE = 2048;
+			// Longer messages (e.g. the profiler report) are copied to the heap instead
+			static constexpr std::size_t MAX_LINE = 512;
+			static constexpr std::size_t MAX_CALLSITES = 1024;
+			static constexpr std::uint32_t RATE_LIMIT = 20;
+
+			explicit AsyncLogSink(std::shared_ptr<spdlog::sinks::sink> target);
+			~AsyncLogSink() override;
+
+			AsyncLogSink(const AsyncLogSink&) = delete;
+			AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+			void log(const spdlog::details::log_msg& msg) override;
+			// Blocks until everything logged so far is written and flushed
+			void flush() override;
+			void set_pattern(const std::string& pattern) override;
+			void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+			// When off lines are written on the calling thread like a plain file sink
+			void SetAsync(bool async);
+			// Written lines at or above this level flush the file
+			void SetFlushLevel(spdlog::level::level_enum level);
+			// Lines per callsite per second, 0 disables rate limiting
+			void SetRateLimit(std::uint32_t perSecond);
+
+		private:
+			struct Entry {
+				std::atomic<std::size_t> sequence;
+				spdlog::log_clock::time_point time;
+				spdlog::source_loc source;
+				spdlog::string_view_t loggerName;
+				spdlog::level::level_enum level;
+				std::size_t threadId;
+				std::size_t length;
+				std::array<char, MAX_LINE> text;
+				// Only used above MAX_LINE, released once written
+				std::string longText;
+			};
+
+			struct Callsite {
+				// Hash of the filename pointer and line, 0 if unused
+				std::atomic<std::uint64_t> key = 0;
+				std::atomic<const char*> filename = nullptr;
+				std::atomic<const char*> funcname = nullptr;
+				std::atomic<int> line = 0;
+				// Level of the first line, used for the repeat note
+				std::atomic<int> level = 0;
+				// Start of the current one second window (ms)
+				std::atomic<std::int64_t> windowStart = 0;
+				std::atomic<std::uint32_t> count = 0;
+				std::atomic<std::size_t> lastHash = 0;
+				// windowStart when lastHash was logged, repeats only fold within the same window
+				std::atomic<std::int64_t> lastHashWindow = -1;
+				std::atomic<std::uint32_t> repeated = 0;
+				std::atomic<std::uint32_t> suppressed = 0;
+			};
+
+			// Returns false if the line should be dropped
+			bool RateLimit(const spdlog::details::log_msg& msg);
+			Callsite* FindCallsite(const spdlog::details::log_msg& msg);
+			// Emits the repeat note of the callsite if it has one
+			void ReportRepeats(Callsite& callsite);
+			void Write(const spdlog::details::log_msg& msg);
+
+			bool Push(const spdlog::details::log_msg& msg);
+			// Single consumer, returns the number of lines written
+			std::size_t Drain();
+			void Run(std::stop_token stop);
+
+			std::shared_ptr<spdlog::sinks::sink> target;
+
+			std::atomic<bool> async = true;
+			std::atomic<int> flushLevel = spdlog::level::trace;
+			std::atomic<std::uint32_t> rateLimit = RATE_LIMIT;
+
+			std::unique_ptr<Entry[]> entries;
+			std::atomic<std::size_t> tail = 0;
+			std::atomic<std::size_t> head = 0;
+			std::atomic<std::size_t> dropped = 0;
+			std::atomic<bool> flushPending = false;
+
+			std::unique_ptr<Callsite[]> callsites;
+
+			std::jthread writer;
+	};
+}
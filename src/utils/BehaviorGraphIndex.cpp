@@ -0,0 +1,155 @@
+#include "managers/animation/AnimationManager.hpp"
+#include "utils/BehaviorGraphIndex.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "utils/actorUtils.hpp"
+#include "data/transient.hpp"
+#include "profiler.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	float Animation_GetSpeedCorrection(Actor* actor) { // Fixes Hug animation de-sync by copying Gts anim speed to Tiny
+		auto transient = Transient::GetSingleton().GetData(actor);
+		if (transient) {
+			if (transient->Hug_AnimSpeed < 1.0f) {
+				return transient->Hug_AnimSpeed;
+			}
+			return AnimationManager::GetAnimSpeed(actor);
+		} 
+		return AnimationManager::GetAnimSpeed(actor);
+	}
+
+	void AffectByPerk(Actor* giant, float& anim_speed) {
+		auto data = Transient::GetSingleton().GetActorData(giant);
+		if (data) {
+			float speed = data->Perk_BonusActionSpeed;
+			if (speed > 1.0f) {
+				bool CanApply = IsStomping(giant) || IsFootGrinding(giant) || IsVoring(giant) || IsTrampling(giant);
+				if (CanApply) {
+					anim_speed *= speed;
+				}
+			}
+		}
+	}
+}
+
+namespace Gts {
+	BehaviorGraphIndex& BehaviorGraphIndex::GetSingleton() noexcept {
+		static BehaviorGraphIndex instance;
+		return instance;
+	}
+
+	std::string BehaviorGraphIndex::DebugName() {
+		return "BehaviorGraphIndex";
+	}
+
+	void BehaviorGraphIndex::Update() {
+		auto profiler = Profilers::Profile("BehaviorGraphIndex: Update");
+		auto actors = ActorRegistry::Actors();
+
+		// An actor usually has one graph (two with a first person skeleton)
+		this->back.Clear(actors.size() * 2);
+		for (auto actor: actors) {
+			if (!actor) {
+				continue;
+			}
+			float anim_speed = 1.0f;
+			AffectByPerk(actor, anim_speed);
+			anim_speed *= Animation_GetSpeedCorrection(actor);
+			if (anim_speed == 1.0f) {
+				continue;
+			}
+
+			BSAnimationGraphManagerPtr animGraphManager;
+			if (actor->GetAnimationGraphManager(animGraphManager)) {
+				for (auto& graph : animGraphManager->graphs) {
+					if (graph && graph->behaviorGraph) {
+						this->back.Insert(graph->behaviorGraph, anim_speed);
+					}
+				}
+			}
+		}
+
+		std::unique_lock guard(this->lock);
+		std::swap(this->front, this->back);
+	}
+
+	void BehaviorGraphIndex::Reset() {
+		std::unique_lock guard(this->lock);
+		this->front.Clear(0);
+		this->back.Clear(0);
+	}
+
+	float BehaviorGraphIndex::GetAnimSpeed(hkbBehaviorGraph* graph) {
+		auto& me = BehaviorGraphIndex::GetSingleton();
+		std::shared_lock guard(me.lock);
+		return me.front.Find(graph);
+	}
+
+	void BehaviorGraphIndex::Table::Clear(std::size_t count) {
+		std::size_t capacity = std::bit_ceil(std::max<std::size_t>(count * 2, 16));
+		if (this->slots.size() != capacity) {
+			this->Resize(capacity);
+		}
+		std::fill(this->slots.begin(), this->slots.end(), Slot());
+		this->used = 0;
+	}
+
+	void BehaviorGraphIndex::Table::Insert(hkbBehaviorGraph* graph, float speed) {
+		// More graphs than Clear was sized for (e.g. creatures with several graphs)
+		if ((this->used + 1) * 2 > this->slots.size()) {
+			std::vector<Slot> old;
+			old.swap(this->slots);
+			this->Resize(std::max<std::size_t>(old.size() * 2, 16));
+			this->used = 0;
+			for (auto& slot: old) {
+				if (slot.graph) {
+					this->Insert(slot.graph, slot.speed);
+				}
+			}
+		}
+		std::size_t mask = this->slots.size() - 1;
+		for (std::size_t i = this->Index(graph);; i = (i + 1) & mask) {
+			auto& slot = this->slots[i];
+			if (!slot.graph) {
+				this->used += 1;
+			}
+			if (!slot.graph || slot.graph == graph) {
+				slot.graph = graph;
+				slot.speed = speed;
+				return;
+			}
+		}
+	}
+
+	float BehaviorGraphIndex::Table::Find(hkbBehaviorGraph* graph) const {
+		if (this->slots.empty()) {
+			return 1.0f;
+		}
+		std::size_t mask = this->slots.size() - 1;
+		// Never more probes than slots, even if the table was somehow filled up
+		for (std::size_t n = 0, i = this->Index(graph); n < this->slots.size(); n++, i = (i + 1) & mask) {
+			auto& slot = this->slots[i];
+			if (slot.graph == graph) {
+				return slot.speed;
+			}
+			if (!slot.graph) {
+				return 1.0f;
+			}
+		}
+		return 1.0f;
+	}
+
+	void BehaviorGraphIndex::Table::Resize(std::size_t capacity) {
+		this->slots.assign(capacity, Slot());
+		this->shift = 64 - static_cast<std::uint32_t>(std::countr_zero(capacity));
+	}
+
+	std::size_t BehaviorGraphIndex::Table::Index(hkbBehaviorGraph* graph) const {
+		// Fibonacci hashing, the low bits of heap pointers are always zero
+		return static_cast<std::size_t>((reinterpret_cast<std::uintptr_t>(graph) * 11400714819323198485ull) >> this->shift);
+	}
+}
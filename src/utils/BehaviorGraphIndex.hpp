@@ -0,0 +1,49 @@
+#pragma once
+// Module that maps behavior graphs to the animation speed of the actor owning them
+//  Rebuilt once per frame on the main thread so Hook_hkbBehaviorGraph::Update, which
+//  the engine calls for every graph from its animation threads, is a single hash probe
+#include "events.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+
+	class BehaviorGraphIndex : public EventListener {
+		public:
+			[[nodiscard]] static BehaviorGraphIndex& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			// Multiplier for the timestep of the graph, 1.0 for graphs without an owner
+			static float GetAnimSpeed(hkbBehaviorGraph* graph);
+
+		private:
+			struct Slot {
+				hkbBehaviorGraph* graph = nullptr;
+				float speed = 1.0f;
+			};
+
+			// Open addressed, grown by Insert to stay at most half full. Only graphs with a speed other than 1.0 are stored
+			struct Table {
+				std::vector<Slot> slots;
+				std::size_t used = 0;
+				std::uint32_t shift = 64;
+
+				void Clear(std::size_t count);
+				void Insert(hkbBehaviorGraph* graph, float speed);
+				float Find(hkbBehaviorGraph* graph) const;
+				std::size_t Index(hkbBehaviorGraph* graph) const;
+				void Resize(std::size_t capacity);
+			};
+
+			std::shared_mutex lock;
+			// Read by the hook
+			Table front;
+			// Filled by Update then swapped with front
+			Table back;
+	};
+}
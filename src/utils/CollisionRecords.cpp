@@ -0,0 +1,163 @@
+#include "utils/CollisionRecords.hpp"
+#include "managers/animation/Grab.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "utils/actorUtils.hpp"
+#include "data/transient.hpp"
+#include "scale/scale.hpp"
+#include "profiler.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	// Size difference (bounding box included) from which actors stop colliding
+	const float ACTOR_IGNORE_LIMIT = 3.0f;
+}
+
+namespace Gts {
+	CollisionRecords& CollisionRecords::GetSingleton() noexcept {
+		static CollisionRecords instance;
+		return instance;
+	}
+
+	std::string CollisionRecords::DebugName() {
+		return "CollisionRecords";
+	}
+
+	void CollisionRecords::Update() {
+		auto profiler = Profilers::Profile("CollisionRecords: Update");
+		std::uint32_t back = 1 - this->published.load(std::memory_order_relaxed);
+		// Only a filter call that started before the last publish can still be here
+		while (this->readers[back].load() != 0) {
+			std::this_thread::yield();
+		}
+
+		auto& table = this->tables[back];
+		table.records.clear();
+		table.grabs.clear();
+		for (auto& record: ActorRegistry::Records()) {
+			Actor* actor = record.actor;
+			if (!actor) {
+				continue;
+			}
+			float visualScale = get_visual_scale(actor);
+			auto transient = Transient::GetSingleton().GetData(record);
+			table.records.push_back(Record {
+				.ref = actor,
+				.disableCollisionWith = transient ? transient->disable_collision_with : nullptr,
+				.visualScale = visualScale,
+				.boundedScale = visualScale * GetSizeFromBoundingBox(actor),
+				.busy = IsGtsBusy(actor),
+				.held = transient && transient->being_held && !record.isDead,
+			});
+
+			Actor* grabbed = Grab::GetHeldActor(actor);
+			if (grabbed && grabbed != actor) {
+				table.grabs.push_back(CollisionRecords::Ordered(actor, grabbed));
+			}
+		}
+		std::sort(table.records.begin(), table.records.end(), [](const Record& a, const Record& b) {
+			return a.ref < b.ref;
+		});
+		std::sort(table.grabs.begin(), table.grabs.end());
+
+		this->published.store(back);
+	}
+
+	void CollisionRecords::Reset() {
+		// Published as an empty table, the old actors may be deleted after this
+		std::uint32_t back = 1 - this->published.load(std::memory_order_relaxed);
+		while (this->readers[back].load() != 0) {
+			std::this_thread::yield();
+		}
+		this->tables[back].records.clear();
+		this->tables[back].grabs.clear();
+		this->published.store(back);
+	}
+
+	bool CollisionRecords::IsCollisionDisabled(TESObjectREFR* refA, TESObjectREFR* refB) {
+		if (!refA || !refB) {
+			return false;
+		}
+		Reader reader;
+		auto& table = reader.Get();
+		auto recordA = table.Find(refA);
+		auto recordB = table.Find(refB);
+
+		if (recordA && recordA->disableCollisionWith == refB) {
+			return true;
+		}
+		if (recordB && recordB->disableCollisionWith == refA) {
+			return true;
+		}
+		if (!recordA || !recordB) {
+			return false;
+		}
+
+		// A is usually the GTS, but can be the tiny as well
+		float sizedifference = recordA->boundedScale / recordB->boundedScale;
+		if (recordA->visualScale / recordB->visualScale < 1.0f) {
+			sizedifference = recordB->boundedScale / recordA->boundedScale;
+		}
+		if (sizedifference >= ACTOR_IGNORE_LIMIT) {
+			return true;
+		}
+		if (recordA->busy && recordB->busy) {
+			return true;
+		}
+		return recordA->held || recordB->held || table.IsGrabbed(refA, refB);
+	}
+
+	float CollisionRecords::GetVisualScale(TESObjectREFR* ref) {
+		if (!ref) {
+			return 0.0f;
+		}
+		Reader reader;
+		auto record = reader.Get().Find(ref);
+		return record ? record->visualScale : 0.0f;
+	}
+
+	const CollisionRecords::Record* CollisionRecords::Table::Find(TESObjectREFR* ref) const {
+		auto found = std::lower_bound(this->records.begin(), this->records.end(), ref, [](const Record& record, TESObjectREFR* key) {
+			return record.ref < key;
+		});
+		if (found != this->records.end() && found->ref == ref) {
+			return &(*found);
+		}
+		return nullptr;
+	}
+
+	bool CollisionRecords::Table::IsGrabbed(TESObjectREFR* refA, TESObjectREFR* refB) const {
+		return std::binary_search(this->grabs.begin(), this->grabs.end(), CollisionRecords::Ordered(refA, refB));
+	}
+
+	CollisionRecords::Reader::Reader() {
+		auto& me = CollisionRecords::GetSingleton();
+		// Seq cst: the publish/readers pair must not be reordered or the writer could miss us
+		for (;;) {
+			this->index = me.published.load();
+			me.readers[this->index].fetch_add(1);
+			if (me.published.load() == this->index) {
+				break;
+			}
+			me.readers[this->index].fetch_sub(1);
+		}
+	}
+
+	CollisionRecords::Reader::~Reader() {
+		CollisionRecords::GetSingleton().readers[this->index].fetch_sub(1);
+	}
+
+	const CollisionRecords::Table& CollisionRecords::Reader::Get() const {
+		return CollisionRecords::GetSingleton().tables[this->index];
+	}
+
+	CollisionRecords::RefPair CollisionRecords::Ordered(TESObjectREFR* refA, TESObjectREFR* refB) {
+		if (refB < refA) {
+			return { refB, refA };
+		}
+		return { refA, refB };
+	}
+}
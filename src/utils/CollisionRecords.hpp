@@ -0,0 +1,70 @@
+#pragma once
+// Module that publishes the per actor data the Havok collision filter needs
+//  The filter runs on Havok worker threads for every candidate pair, it used to read Transient
+//  (unlocked) and compute scales per pair. The main thread now fills a table once per frame
+//  and the filter only reads the published one, readers never block
+#include "events.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+
+	class CollisionRecords : public EventListener {
+		public:
+			[[nodiscard]] static CollisionRecords& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+
+			// Any thread: true if the two refs should not collide because of size, grabs or
+			// Transient disable_collision_with. Unknown refs (not loaded actors) never match
+			static bool IsCollisionDisabled(TESObjectREFR* refA, TESObjectREFR* refB);
+			// Any thread: visual scale published for the ref, 0 if it isn't a loaded actor
+			static float GetVisualScale(TESObjectREFR* ref);
+
+		private:
+			struct Record {
+				TESObjectREFR* ref;
+				TESObjectREFR* disableCollisionWith;
+				float visualScale;
+				// visualScale * GetSizeFromBoundingBox
+				float boundedScale;
+				bool busy;
+				// Transient being_held of a living actor, collides with nobody
+				bool held;
+			};
+			using RefPair = std::pair<TESObjectREFR*, TESObjectREFR*>;
+
+			struct Table {
+				// Sorted by ref
+				std::vector<Record> records;
+				// (giant, held tiny) ordered by pointer and sorted
+				std::vector<RefPair> grabs;
+
+				const Record* Find(TESObjectREFR* ref) const;
+				bool IsGrabbed(TESObjectREFR* refA, TESObjectREFR* refB) const;
+			};
+
+			// Keeps the table it points at from being rewritten while it is alive
+			class Reader {
+				public:
+					Reader();
+					~Reader();
+					Reader(const Reader&) = delete;
+					Reader& operator=(const Reader&) = delete;
+
+					const Table& Get() const;
+				private:
+					std::uint32_t index;
+			};
+
+			static RefPair Ordered(TESObjectREFR* refA, TESObjectREFR* refB);
+
+			std::array<Table, 2> tables;
+			std::atomic<std::uint32_t> published = 0;
+			std::array<std::atomic<std::uint32_t>, 2> readers = {};
+	};
+}
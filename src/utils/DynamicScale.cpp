@@ -4,12 +4,37 @@
 #include "UI/DebugAPI.hpp"
 #include "scale/scale.hpp"
 #include "rays/raycast.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+#include "Config.hpp"
 
 using namespace Gts;
 using namespace RE;
 using namespace SKSE;
 using namespace std;
 
+namespace {
+	// Size of the xy squares a ceiling sample covers
+	const float CEILING_GRID_SIZE = 96.0f;
+	// Height of the z bands, so a balcony or stairs above/below the same xy gets its own sample
+	const float CEILING_BAND_HEIGHT = 64.0f;
+	// Width of a scale band, samples cast by an actor in our band are reused
+	const float CEILING_SCALE_TOLERANCE = 0.10f;
+	const std::size_t MAX_CEILING_SAMPLES = 4096;
+
+	// cell | x (12 bits) | y (12 bits) | z (8 bits), the coordinates wrap but a cell is far smaller than that
+	std::uint64_t CeilingKey(TESObjectCELL* cell, const NiPoint3& position) {
+		auto gx = static_cast<std::uint64_t>(static_cast<std::int64_t>(std::floor(position.x / CEILING_GRID_SIZE))) & 0xFFF;
+		auto gy = static_cast<std::uint64_t>(static_cast<std::int64_t>(std::floor(position.y / CEILING_GRID_SIZE))) & 0xFFF;
+		auto gz = static_cast<std::uint64_t>(static_cast<std::int64_t>(std::floor(position.z / CEILING_BAND_HEIGHT))) & 0xFF;
+		return (static_cast<std::uint64_t>(cell->formID) << 32) | (gx << 20) | (gy << 8) | gz;
+	}
+
+	std::int32_t CeilingScaleBand(float scale) {
+		return static_cast<std::int32_t>(std::floor(std::log(std::max(scale, 0.001f)) / std::log1p(CEILING_SCALE_TOLERANCE)));
+	}
+}
+
 namespace Gts {
 	float GetCeilingHeight(Actor* giant) {
 		if (!giant) {
@@ -153,29 +178,29 @@ namespace Gts {
 	float GetMaxRoomScale(Actor* giant) {
 		float stateScale = GetRoomStateScale(giant);
 
-		float room_height_m = GetCeilingHeight(giant);
+		float room_height_m = DynamicScale::GetCachedCeilingHeight(giant);
 
 		// Spring
 		auto& dynamicData = DynamicScale::GetData(giant);
-		dynamicData.roomHeight.halflife = 0.85f;
+		dynamicData.roomHeight.SetHalfLife(0.85f);
 		if (!std::isinf(room_height_m)) {
 			// Under roof
-			if (std::isinf(dynamicData.roomHeight.target)) {
+			if (std::isinf(dynamicData.roomHeight.GetTarget())) {
 				// Last check was infinity so we just went under a roof
 				// Snap current value to new roof
-				dynamicData.roomHeight.value = room_height_m;
-				dynamicData.roomHeight.velocity = 0.0f;
+				dynamicData.roomHeight.SetValue(room_height_m);
+				dynamicData.roomHeight.SetVelocity(0.0f);
 			}
 
-			dynamicData.roomHeight.target = room_height_m;
-			room_height_m = dynamicData.roomHeight.value;
+			dynamicData.roomHeight.SetTarget(room_height_m);
+			room_height_m = dynamicData.roomHeight.GetValue();
 		} else {
 			// No roof, set roomHeight to infinity so we know that we left the roof
 			// then continue as normal
-			if (!std::isinf(dynamicData.roomHeight.target)) {
-				dynamicData.roomHeight.target = room_height_m;
-				dynamicData.roomHeight.value = room_height_m;
-				dynamicData.roomHeight.velocity = 0.0f;
+			if (!std::isinf(dynamicData.roomHeight.GetTarget())) {
+				dynamicData.roomHeight.SetTarget(room_height_m);
+				dynamicData.roomHeight.SetValue(room_height_m);
+				dynamicData.roomHeight.SetVelocity(0.0f);
 			}
 		}
 
@@ -187,7 +212,7 @@ namespace Gts {
 
 	DynamicScaleData::DynamicScaleData() : roomHeight(
 			Spring(std::numeric_limits<float>::infinity(), 1.0f)
-			) {
+			), lastCeiling(std::numeric_limits<float>::infinity()) {
 	}
 
 	DynamicScale& DynamicScale::GetSingleton() {
@@ -199,6 +224,95 @@ namespace Gts {
 		return "DynamicScale";
 	}
 
+	void DynamicScale::Reset() {
+		this->ceilings.clear();
+		this->waiting.clear();
+		this->reserved.clear();
+		for (auto& [formID, actorData]: this->data) {
+			actorData.ceilingQueued = false;
+		}
+	}
+
+	float DynamicScale::GetCachedCeilingHeight(Actor* actor) {
+		auto profiler = Profilers::Profile("DynamicScale: CeilingCache");
+		if (!actor) {
+			return std::numeric_limits<float>::infinity();
+		}
+		auto cell = actor->GetParentCell();
+		if (!cell) {
+			return GetCeilingHeight(actor);
+		}
+		auto& manager = DynamicScale::GetSingleton();
+		auto& config = Config::GetSingleton().GetRoomScale();
+
+		std::uint64_t frame = Time::FramesElapsed();
+		if (manager.budgetFrame != frame) {
+			manager.budgetFrame = frame;
+			manager.budgetLeft = config.GetRaycastBudget();
+			// Whoever was refused longest gets the budget first, the rest is first come first served
+			manager.reserved.clear();
+			while (!manager.waiting.empty() && manager.reserved.size() < static_cast<std::size_t>(std::max(manager.budgetLeft, 0))) {
+				FormID next = manager.waiting.front();
+				manager.waiting.pop_front();
+				auto waiter = manager.data.find(next);
+				if (waiter != manager.data.end()) {
+					waiter->second.ceilingQueued = false;
+				}
+				manager.reserved.push_back(next);
+			}
+		}
+
+		auto& actorData = DynamicScale::GetData(actor);
+		float scale = get_visual_scale(actor);
+		double now = Time::WorldTimeElapsed();
+		auto key = CeilingSampleKey {
+			.area = CeilingKey(cell, actor->GetPosition()),
+			.band = CeilingScaleBand(scale),
+		};
+
+		auto found = manager.ceilings.find(key);
+		bool usable = found != manager.ceilings.end();
+		bool stale = usable && now - found->second.time > config.GetRefreshInterval();
+		if (usable && !stale) {
+			actorData.lastCeiling = found->second.height;
+			return found->second.height;
+		}
+
+		// Reserved actors may not all ask this frame (unloaded), they only hold back the budget until they do
+		auto reservation = std::find(manager.reserved.begin(), manager.reserved.end(), actor->formID);
+		bool granted = false;
+		if (reservation != manager.reserved.end()) {
+			manager.reserved.erase(reservation);
+			granted = true;
+		} else {
+			granted = manager.budgetLeft > static_cast<int>(manager.reserved.size()) || (!usable && actor->formID == 0x14);
+		}
+		if (!granted) {
+			if (!actorData.ceilingQueued) {
+				actorData.ceilingQueued = true;
+				manager.waiting.push_back(actor->formID);
+			}
+			if (usable) {
+				actorData.lastCeiling = found->second.height;
+				return found->second.height;
+			}
+			// New area but no scans left this frame, keep what we had until our turn comes
+			return actorData.lastCeiling;
+		}
+
+		manager.budgetLeft -= 1;
+		float height = GetCeilingHeight(actor);
+		if (manager.ceilings.size() > MAX_CEILING_SAMPLES) {
+			manager.ceilings.clear(); // Mostly cells we left long ago
+		}
+		manager.ceilings.insert_or_assign(key, CeilingSample {
+			.height = height,
+			.time = now,
+		});
+		actorData.lastCeiling = height;
+		return height;
+	}
+
 	DynamicScaleData& DynamicScale::GetData(Actor* actor) {
 		if (!actor) {
 			throw std::exception("DynamicScale::GetData: Actor must exist");
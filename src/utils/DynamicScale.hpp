@@ -17,6 +17,30 @@ namespace Gts {
 			DynamicScaleData();
 
 			Spring roomHeight;
+			// Last ceiling this actor got, used when the ray budget is spent
+			float lastCeiling;
+			// Waiting in DynamicScale's ray queue
+			bool ceilingQueued = false;
+	};
+
+	// Cached result of GetCeilingHeight for one area of a cell
+	struct CeilingSample {
+		float height;
+		double time;
+	};
+
+	// The rays grow with scale, so each scale band of an area has its own sample
+	struct CeilingSampleKey {
+		std::uint64_t area;
+		std::int32_t band;
+
+		bool operator==(const CeilingSampleKey& other) const = default;
+	};
+
+	struct CeilingSampleKeyHash {
+		std::size_t operator()(const CeilingSampleKey& key) const noexcept {
+			return std::hash<std::uint64_t>{}(key.area ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.band)) * 0x9E3779B97F4A7C15ull));
+		}
 	};
 
 	class DynamicScale : public EventListener {
@@ -24,9 +48,21 @@ namespace Gts {
 			[[nodiscard]] static DynamicScale& GetSingleton();
 
 			virtual std::string DebugName() override;
+			virtual void Reset() override;
 
 			static DynamicScaleData& GetData(Actor* actor);
 
+			// GetCeilingHeight but cached per cell area and limited to a few scans per frame
+			static float GetCachedCeilingHeight(Actor* actor);
+
 			std::unordered_map<FormID, DynamicScaleData> data;
+		private:
+			std::unordered_map<CeilingSampleKey, CeilingSample, CeilingSampleKeyHash> ceilings;
+			std::uint64_t budgetFrame = 0;
+			int budgetLeft = 0;
+			// Actors that were refused a ray, oldest first
+			std::deque<FormID> waiting;
+			// Taken from waiting at the start of the frame, the budget is kept for them first
+			std::vector<FormID> reserved;
 	};
 }
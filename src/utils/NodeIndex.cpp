@@ -0,0 +1,235 @@
+#include "utils/NodeIndex.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	// Guards against cyclic/corrupt trees, a character with armor is well below this
+	const std::size_t MAX_NODES = 4096;
+	// Names that were not found are only trusted for this long (seconds), nodes attached
+	// without an equip event (e.g. by other plugins) are picked up after that
+	const double MISS_REBUILD_TIME = 5.0;
+}
+
+namespace Gts {
+	NodeIndex& NodeIndex::GetSingleton() noexcept {
+		static NodeIndex instance;
+		return instance;
+	}
+
+	std::string NodeIndex::DebugName() {
+		return "NodeIndex";
+	}
+
+	void NodeIndex::Update() {
+		auto profiler = Profilers::Profile("NodeIndex: Update");
+		std::vector<Entry> released;
+		{
+			std::unique_lock guard(this->lock);
+			// The game dropped every reference to this 3D except ours
+			std::erase_if(this->entries, [](const auto& item) {
+				return item.second.root->GetRefCount() <= 1;
+			});
+			released.swap(this->retired);
+		}
+		// Destroyed here on the main thread, outside the lock
+	}
+
+	void NodeIndex::Reset() {
+		std::unique_lock guard(this->lock);
+		this->entries.clear();
+		this->retired.clear();
+	}
+
+	void NodeIndex::ResetActor(Actor* actor) {
+		NodeIndex::Invalidate(actor);
+	}
+
+	void NodeIndex::ActorEquip(Actor* actor) {
+		NodeIndex::Invalidate(actor);
+	}
+
+	void NodeIndex::ActorLoaded(Actor* actor) {
+		NodeIndex::Invalidate(actor);
+	}
+
+	NiAVObject* NodeIndex::Find(TESObjectREFR* owner, NiAVObject* root, std::string_view name) {
+		if (!owner || !root) {
+			return nullptr;
+		}
+		auto& me = NodeIndex::GetSingleton();
+		double now = Time::WorldTimeElapsed();
+		{
+			std::shared_lock guard(me.lock);
+			auto entry = me.entries.find(root);
+			if (entry != me.entries.end() && entry->second.owner == owner->formID) {
+				auto& nodes = entry->second.nodes;
+				auto found = nodes.find(name);
+				if (found != nodes.end()) {
+					if (NodeIndex::IsAttached(found->second, root)) {
+						return found->second;
+					}
+				} else if (now - entry->second.builtTime < MISS_REBUILD_TIME) {
+					return nullptr;
+				}
+			}
+		}
+
+		std::unique_lock guard(me.lock);
+		auto& entry = me.Rebuild(owner, root);
+		auto found = entry.nodes.find(name);
+		if (found != entry.nodes.end() && NodeIndex::IsAttached(found->second, root)) {
+			return found->second;
+		}
+		return nullptr;
+	}
+
+	NiAVObject* NodeIndex::FindRegex(TESObjectREFR* owner, NiAVObject* root, std::string_view pattern) {
+		if (!owner || !root) {
+			return nullptr;
+		}
+		auto& me = NodeIndex::GetSingleton();
+		double now = Time::WorldTimeElapsed();
+		{
+			std::shared_lock guard(me.lock);
+			auto entry = me.entries.find(root);
+			if (entry != me.entries.end() && entry->second.owner == owner->formID) {
+				auto& matches = entry->second.regexMatches;
+				auto found = matches.find(pattern);
+				if (found != matches.end()) {
+					if (found->second) {
+						if (NodeIndex::IsAttached(found->second, root)) {
+							return found->second;
+						}
+					} else if (now - entry->second.builtTime < MISS_REBUILD_TIME) {
+						return nullptr;
+					}
+				}
+			}
+		}
+
+		auto regex = NodeIndex::GetRegex(pattern);
+		if (!regex) {
+			return nullptr;
+		}
+
+		std::unique_lock guard(me.lock);
+		auto entry = me.entries.find(root);
+		Entry* current = nullptr;
+		if (entry != me.entries.end() && entry->second.owner == owner->formID && now - entry->second.builtTime < MISS_REBUILD_TIME) {
+			current = &entry->second;
+		} else {
+			current = &me.Rebuild(owner, root);
+		}
+
+		NiAVObject* result = nullptr;
+		for (auto& node: current->order) {
+			// Same as Find, a node of unequipped armor may still be in an older order list
+			if (std::regex_match(node->name.c_str(), *regex) && NodeIndex::IsAttached(node.get(), root)) {
+				result = node.get();
+				break;
+			}
+		}
+		current->regexMatches.insert_or_assign(std::string(pattern), result);
+		return result;
+	}
+
+	void NodeIndex::Invalidate(TESObjectREFR* owner) {
+		if (!owner) {
+			return;
+		}
+		auto& me = NodeIndex::GetSingleton();
+		FormID id = owner->formID;
+		std::unique_lock guard(me.lock);
+		for (auto item = me.entries.begin(); item != me.entries.end();) {
+			if (item->second.owner == id) {
+				me.Retire(item->second);
+				item = me.entries.erase(item);
+			} else {
+				++item;
+			}
+		}
+	}
+
+	NodeIndex::Entry& NodeIndex::Rebuild(TESObjectREFR* owner, NiAVObject* root) {
+		double now = Time::WorldTimeElapsed();
+		auto& entry = this->entries[root];
+		if (entry.root.get() == root && entry.owner == owner->formID && entry.builtTime == now) {
+			// Another thread rebuilt it while we were waiting for the lock
+			return entry;
+		}
+		auto profiler = Profilers::Profile("NodeIndex: Rebuild");
+
+		this->Retire(entry);
+		entry.owner = owner->formID;
+		entry.root = NiPointer<NiAVObject>(root);
+		entry.nodes.clear();
+		entry.regexMatches.clear();
+		entry.order.clear();
+		entry.builtTime = now;
+
+		// Depth first, same order as GetObjectByName so duplicate names resolve the same way
+		std::vector<NiAVObject*> stack = { root };
+		while (!stack.empty()) {
+			auto current = stack.back();
+			stack.pop_back();
+
+			if (entry.order.size() >= MAX_NODES) {
+				log::error("NodeIndex : Possible Endless Loop on {}", owner->GetDisplayFullName());
+				break;
+			}
+			entry.order.emplace_back(current);
+			entry.nodes.try_emplace(std::string(current->name.c_str()), current);
+
+			auto ninode = current->AsNode();
+			if (ninode) {
+				auto& children = ninode->GetChildren();
+				for (auto child = children.rbegin(); child != children.rend(); ++child) {
+					if (*child) {
+						stack.push_back(child->get());
+					}
+				}
+			}
+		}
+		return entry;
+	}
+
+	void NodeIndex::Retire(Entry& entry) {
+		if (entry.root || !entry.order.empty()) {
+			this->retired.push_back(std::exchange(entry, Entry()));
+		}
+	}
+
+	bool NodeIndex::IsAttached(NiAVObject* node, NiAVObject* root) {
+		// Nodes of unequipped armor are detached from the skeleton but kept alive by us
+		std::size_t depth = 0;
+		while (node && depth < MAX_NODES) {
+			if (node == root) {
+				return true;
+			}
+			node = node->parent;
+			depth += 1;
+		}
+		return false;
+	}
+
+	const std::regex* NodeIndex::GetRegex(std::string_view pattern) {
+		auto& me = NodeIndex::GetSingleton();
+		std::unique_lock guard(me.regexLock);
+		auto found = me.regexes.find(pattern);
+		if (found != me.regexes.end()) {
+			return &found->second;
+		}
+		try {
+			auto [inserted, _] = me.regexes.try_emplace(std::string(pattern), std::string(pattern));
+			return &inserted->second;
+		} catch (const std::regex_error& e) {
+			log::warn("NodeIndex : Invalid node regex {}: {}", pattern, e.what());
+			return nullptr;
+		}
+	}
+}
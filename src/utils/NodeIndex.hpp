@@ -0,0 +1,69 @@
+#pragma once
+// Module that caches the name -> node lookups of a 3D tree
+//  find_node & co. used to walk the whole scene graph on every call, now the tree is
+//  walked once per loaded 3D root and each lookup is a hash lookup
+//  Entries are dropped when the 3D is reset/equipped/unloaded or replaced by a new root
+#include "events.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+
+	class NodeIndex : public EventListener {
+		public:
+			[[nodiscard]] static NodeIndex& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+			virtual void ActorEquip(Actor* actor) override;
+			virtual void ActorLoaded(Actor* actor) override;
+
+			// root is the 3D of owner that should be searched (e.g. Get3D(first_person))
+			static NiAVObject* Find(TESObjectREFR* owner, NiAVObject* root, std::string_view name);
+			// First node (depth first, same order as GetObjectByName) whose name matches the regex
+			static NiAVObject* FindRegex(TESObjectREFR* owner, NiAVObject* root, std::string_view pattern);
+			// Drops every cached root of the owner, they are rebuilt on the next lookup
+			static void Invalidate(TESObjectREFR* owner);
+
+		private:
+			struct NameHash {
+				using is_transparent = void;
+				std::size_t operator()(std::string_view name) const noexcept {
+					return std::hash<std::string_view>{}(name);
+				}
+			};
+			using NameMap = std::unordered_map<std::string, NiAVObject*, NameHash, std::equal_to<>>;
+
+			struct Entry {
+				FormID owner = 0;
+				// Holding the root keeps its address from being reused while it is cached
+				NiPointer<NiAVObject> root;
+				// First node of each name in depth first order
+				NameMap nodes;
+				// Memoized FindRegex results, null if nothing matched
+				NameMap regexMatches;
+				// All nodes in depth first order, the references keep the raw pointers above alive
+				std::vector<NiPointer<NiAVObject>> order;
+				double builtTime = 0.0;
+			};
+
+			// Must hold lock exclusively
+			Entry& Rebuild(TESObjectREFR* owner, NiAVObject* root);
+			void Retire(Entry& entry);
+			static bool IsAttached(NiAVObject* node, NiAVObject* root);
+			static const std::regex* GetRegex(std::string_view pattern);
+
+			std::shared_mutex lock;
+			std::unordered_map<NiAVObject*, Entry> entries;
+			// Entries dropped by Find/Invalidate, which may run on any thread. Their node references
+			// are released by Update on the main thread so a scene node is never freed elsewhere
+			std::vector<Entry> retired;
+
+			std::mutex regexLock;
+			std::unordered_map<std::string, std::regex, NameHash, std::equal_to<>> regexes;
+	};
+}
@@ -0,0 +1,356 @@
+#include "utils/ObjectGrid.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	// Same bucket size as the ActorGrid
+	const float BUCKET_SIZE = 1024.0f;
+	// Objects not followed this frame may have moved a bit since their last refresh
+	const float MOVE_SLACK = 256.0f;
+	// Sleeping objects refreshed per frame
+	const std::size_t REFRESH_BUDGET = 64;
+	// How long (seconds) a pushed object is followed every frame
+	const double AWAKE_TIME = 5.0;
+}
+
+namespace Gts {
+	ObjectGrid& ObjectGrid::GetSingleton() noexcept {
+		static ObjectGrid instance;
+		return instance;
+	}
+
+	std::string ObjectGrid::DebugName() {
+		return "ObjectGrid";
+	}
+
+	void ObjectGrid::DataReady() {
+		auto event_sources = ScriptEventSourceHolder::GetSingleton();
+		if (event_sources) {
+			event_sources->AddEventSink<TESCellAttachDetachEvent>(this);
+			event_sources->AddEventSink<TESObjectLoadedEvent>(this);
+		}
+	}
+
+	void ObjectGrid::Reset() {
+		this->entries.clear();
+		this->freeEntries.clear();
+		this->byForm.clear();
+		this->buckets.clear();
+		this->scannedCells.clear();
+		this->awake.clear();
+		this->refreshCursor = 0;
+		std::unique_lock lock(this->pendingLock);
+		this->pending.clear();
+	}
+
+	void ObjectGrid::Update() {
+		auto profiler = Profilers::Profile("ObjectGrid: Update");
+		this->ProcessPending();
+
+		double now = Time::WorldTimeElapsed();
+		std::erase_if(this->awake, [this, now](std::uint32_t index) {
+			auto& entry = this->entries[index];
+			if (!entry.used || entry.awakeUntil < now) {
+				return true;
+			}
+			auto ref = entry.handle.get();
+			return !this->Refresh(index, ref.get());
+		});
+
+		std::size_t budget = std::min(REFRESH_BUDGET, this->entries.size());
+		for (std::size_t i = 0; i < budget; i++) {
+			this->refreshCursor = (this->refreshCursor + 1) % this->entries.size();
+			if (this->entries[this->refreshCursor].used) {
+				auto ref = this->entries[this->refreshCursor].handle.get();
+				this->Refresh(static_cast<std::uint32_t>(this->refreshCursor), ref.get());
+			}
+		}
+	}
+
+	std::vector<ObjectRefHandle> ObjectGrid::Query(const NiPoint3& center, float radius, TESObjectCELL* cell) {
+		auto profiler = Profilers::Profile("ObjectGrid: Query");
+		if (!ActorRegistry::OnRegistryThread()) {
+			// The grid is only changed on the main thread, Query refreshes and indexes entries
+			static std::once_flag warned;
+			std::call_once(warned, [] {
+				log::warn("ObjectGrid: Query called off the main thread, scanning the cell");
+			});
+			return ObjectGrid::QueryOffThread(center, radius, cell);
+		}
+		auto& me = ObjectGrid::GetSingleton();
+		me.ProcessPending();
+		if (cell && cell->IsAttached() && !me.scannedCells.contains(cell)) {
+			me.IndexCell(cell);
+		}
+
+		std::vector<ObjectRefHandle> result;
+		float reach = radius + MOVE_SLACK;
+		float reachSq = reach * reach;
+		float radiusSq = radius * radius;
+		std::int64_t minX = BucketCoord(center.x - reach);
+		std::int64_t maxX = BucketCoord(center.x + reach);
+		std::int64_t minY = BucketCoord(center.y - reach);
+		std::int64_t maxY = BucketCoord(center.y + reach);
+
+		auto test = [&](std::uint32_t index) {
+			auto& entry = me.entries[index];
+			if (!entry.used || (cell && entry.cell != cell)) {
+				return;
+			}
+			NiPoint3 delta = entry.position - center;
+			if (delta.x * delta.x + delta.y * delta.y + delta.z * delta.z > reachSq) {
+				return;
+			}
+			// Candidates are checked against where they are now
+			auto ref = entry.handle.get();
+			if (!me.Refresh(index, ref.get())) {
+				return;
+			}
+			delta = entry.position - center;
+			if (delta.x * delta.x + delta.y * delta.y + delta.z * delta.z <= radiusSq) {
+				result.push_back(entry.handle);
+			}
+		};
+
+		std::uint64_t bucketCount = static_cast<std::uint64_t>(maxX - minX + 1) * static_cast<std::uint64_t>(maxY - minY + 1);
+		if (bucketCount >= me.buckets.size()) {
+			// Huge radius (very big giants), walking the occupied buckets is cheaper
+			std::vector<std::uint32_t> indices;
+			for (auto& [key, bucket]: me.buckets) {
+				indices.insert(indices.end(), bucket.begin(), bucket.end());
+			}
+			for (auto index: indices) {
+				test(index);
+			}
+			return result;
+		}
+
+		std::vector<std::uint32_t> indices;
+		for (std::int64_t x = minX; x <= maxX; x++) {
+			for (std::int64_t y = minY; y <= maxY; y++) {
+				auto found = me.buckets.find(BucketKey(x, y));
+				if (found != me.buckets.end()) {
+					indices.insert(indices.end(), found->second.begin(), found->second.end());
+				}
+			}
+		}
+		// Refresh may move entries between buckets, so they are collected first
+		for (auto index: indices) {
+			test(index);
+		}
+		return result;
+	}
+
+	void ObjectGrid::Wake(TESObjectREFR* ref) {
+		if (!ref) {
+			return;
+		}
+		if (!ActorRegistry::OnRegistryThread()) {
+			return;
+		}
+		auto& me = ObjectGrid::GetSingleton();
+		auto found = me.byForm.find(ref->formID);
+		if (found == me.byForm.end()) {
+			return;
+		}
+		auto& entry = me.entries[found->second];
+		if (entry.awakeUntil < Time::WorldTimeElapsed()) {
+			me.awake.push_back(found->second);
+		}
+		entry.awakeUntil = Time::WorldTimeElapsed() + AWAKE_TIME;
+	}
+
+	BSEventNotifyControl ObjectGrid::ProcessEvent(const TESCellAttachDetachEvent* evn, BSTEventSource<TESCellAttachDetachEvent>* dispatcher) {
+		if (evn && evn->reference) {
+			std::unique_lock lock(this->pendingLock);
+			this->pending.emplace_back(evn->reference->formID, evn->attached);
+		}
+		return BSEventNotifyControl::kContinue;
+	}
+
+	BSEventNotifyControl ObjectGrid::ProcessEvent(const TESObjectLoadedEvent* evn, BSTEventSource<TESObjectLoadedEvent>* dispatcher) {
+		// Dropped/spawned objects don't get a cell attach event
+		if (evn) {
+			std::unique_lock lock(this->pendingLock);
+			this->pending.emplace_back(evn->formID, evn->loaded);
+		}
+		return BSEventNotifyControl::kContinue;
+	}
+
+	bool ObjectGrid::IsLooseObject(TESObjectREFR* ref) {
+		if (!ref || ref->Is(FormType::ActorCharacter) || ref->IsDeleted() || ref->IsDisabled()) {
+			return false;
+		}
+		auto base = ref->GetBaseObject();
+		if (!base) {
+			return false;
+		}
+		switch (base->GetFormType()) {
+			case FormType::Misc:
+			case FormType::Weapon:
+			case FormType::Armor:
+			case FormType::Book:
+			case FormType::Ingredient:
+			case FormType::AlchemyItem:
+			case FormType::Ammo:
+			case FormType::KeyMaster:
+			case FormType::SoulGem:
+			case FormType::Scroll:
+			case FormType::Light:
+			case FormType::MovableStatic: {
+				return true;
+			}
+			default: {
+				// Anything else is only worth tracking if it can be broken
+				auto destructible = base->As<BGSDestructibleObjectForm>();
+				return destructible && destructible->data;
+			}
+		}
+	}
+
+	std::vector<ObjectRefHandle> ObjectGrid::QueryOffThread(const NiPoint3& center, float radius, TESObjectCELL* cell) {
+		std::vector<ObjectRefHandle> result;
+		if (!cell || !cell->IsAttached()) {
+			return result;
+		}
+		float radiusSq = radius * radius;
+		for (auto& object: cell->GetRuntimeData().references) {
+			if (!object || !IsLooseObject(object.get())) {
+				continue;
+			}
+			NiPoint3 delta = object->GetPosition() - center;
+			if (delta.x * delta.x + delta.y * delta.y + delta.z * delta.z <= radiusSq) {
+				result.push_back(object->CreateRefHandle());
+			}
+		}
+		return result;
+	}
+
+	std::int64_t ObjectGrid::BucketCoord(float value) {
+		return static_cast<std::int64_t>(std::floor(value / BUCKET_SIZE));
+	}
+
+	std::uint64_t ObjectGrid::BucketKey(std::int64_t x, std::int64_t y) {
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+	}
+
+	void ObjectGrid::ProcessPending() {
+		std::vector<std::pair<FormID, bool>> events;
+		{
+			std::unique_lock lock(this->pendingLock);
+			if (this->pending.empty()) {
+				return;
+			}
+			std::swap(events, this->pending);
+		}
+		bool detached = false;
+		for (auto [formID, attached]: events) {
+			if (attached) {
+				this->Add(TESForm::LookupByID<TESObjectREFR>(formID));
+			} else {
+				this->Remove(formID);
+				detached = true;
+			}
+		}
+		if (detached) {
+			// A cell that is attached again has to be scanned again
+			std::erase_if(this->scannedCells, [](TESObjectCELL* cell) {
+				return !cell->IsAttached();
+			});
+		}
+	}
+
+	void ObjectGrid::IndexCell(TESObjectCELL* cell) {
+		auto profiler = Profilers::Profile("ObjectGrid: IndexCell");
+		this->scannedCells.insert(cell);
+		for (auto& object: cell->GetRuntimeData().references) {
+			if (object) {
+				this->Add(object.get());
+			}
+		}
+	}
+
+	void ObjectGrid::Add(TESObjectREFR* ref) {
+		if (!IsLooseObject(ref)) {
+			return;
+		}
+		auto found = this->byForm.find(ref->formID);
+		if (found != this->byForm.end()) {
+			this->Refresh(found->second, ref);
+			return;
+		}
+
+		std::uint32_t index;
+		if (!this->freeEntries.empty()) {
+			index = this->freeEntries.back();
+			this->freeEntries.pop_back();
+		} else {
+			index = static_cast<std::uint32_t>(this->entries.size());
+			this->entries.emplace_back();
+		}
+		auto& entry = this->entries[index];
+		entry = Entry {
+			.handle = ref->CreateRefHandle(),
+			.formID = ref->formID,
+			.cell = ref->GetParentCell(),
+			.position = ref->GetPosition(),
+			.used = true,
+		};
+		entry.bucket = BucketKey(BucketCoord(entry.position.x), BucketCoord(entry.position.y));
+		this->buckets[entry.bucket].push_back(index);
+		this->byForm.emplace(ref->formID, index);
+	}
+
+	void ObjectGrid::Remove(FormID formID) {
+		auto found = this->byForm.find(formID);
+		if (found != this->byForm.end()) {
+			this->RemoveEntry(found->second);
+		}
+	}
+
+	void ObjectGrid::RemoveEntry(std::uint32_t index) {
+		auto& entry = this->entries[index];
+		if (!entry.used) {
+			return;
+		}
+		auto bucket = this->buckets.find(entry.bucket);
+		if (bucket != this->buckets.end()) {
+			std::erase(bucket->second, index);
+			if (bucket->second.empty()) {
+				this->buckets.erase(bucket);
+			}
+		}
+		this->byForm.erase(entry.formID);
+		entry = Entry();
+		this->freeEntries.push_back(index);
+	}
+
+	bool ObjectGrid::Refresh(std::uint32_t index, TESObjectREFR* ref) {
+		auto& entry = this->entries[index];
+		if (!ref || ref->formID != entry.formID || ref->IsDeleted() || ref->IsDisabled()) {
+			this->RemoveEntry(index);
+			return false;
+		}
+		entry.position = ref->GetPosition();
+		entry.cell = ref->GetParentCell();
+		std::uint64_t bucket = BucketKey(BucketCoord(entry.position.x), BucketCoord(entry.position.y));
+		if (bucket != entry.bucket) {
+			auto old = this->buckets.find(entry.bucket);
+			if (old != this->buckets.end()) {
+				std::erase(old->second, index);
+				if (old->second.empty()) {
+					this->buckets.erase(old);
+				}
+			}
+			this->buckets[bucket].push_back(index);
+			entry.bucket = bucket;
+		}
+		return true;
+	}
+}
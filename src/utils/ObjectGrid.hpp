@@ -0,0 +1,73 @@
+#pragma once
+// Module that keeps a spatial hash of loose objects (clutter that can be pushed or broken)
+//  References are added/removed as their cell attaches/detaches or their 3D loads, so launching
+//  objects no longer walks every reference of the cell (or of the whole world on SE)
+//  Positions are followed every frame for objects that were pushed, the rest are refreshed a slice per frame
+#include "events.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+
+	class ObjectGrid : public EventListener,
+		public BSTEventSink<TESCellAttachDetachEvent>,
+		public BSTEventSink<TESObjectLoadedEvent> {
+		public:
+			[[nodiscard]] static ObjectGrid& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void DataReady() override;
+			virtual void Reset() override;
+			virtual void Update() override;
+
+			// Loose objects whose current position is within radius of the center
+			// If cell is given only the objects of that cell are returned
+			// Main thread only, elsewhere only the references of cell are scanned (none without a cell)
+			static std::vector<ObjectRefHandle> Query(const NiPoint3& center, float radius, TESObjectCELL* cell = nullptr);
+			// The object was pushed, its position is followed every frame for a while (main thread only)
+			static void Wake(TESObjectREFR* ref);
+
+		protected:
+			virtual BSEventNotifyControl ProcessEvent(const TESCellAttachDetachEvent* evn, BSTEventSource<TESCellAttachDetachEvent>* dispatcher) override;
+			virtual BSEventNotifyControl ProcessEvent(const TESObjectLoadedEvent* evn, BSTEventSource<TESObjectLoadedEvent>* dispatcher) override;
+
+		private:
+			struct Entry {
+				ObjectRefHandle handle;
+				FormID formID = 0;
+				TESObjectCELL* cell = nullptr;
+				NiPoint3 position;
+				std::uint64_t bucket = 0;
+				double awakeUntil = 0.0;
+				bool used = false;
+			};
+
+			static bool IsLooseObject(TESObjectREFR* ref);
+			static std::vector<ObjectRefHandle> QueryOffThread(const NiPoint3& center, float radius, TESObjectCELL* cell);
+			static std::int64_t BucketCoord(float value);
+			static std::uint64_t BucketKey(std::int64_t x, std::int64_t y);
+
+			void ProcessPending();
+			void IndexCell(TESObjectCELL* cell);
+			void Add(TESObjectREFR* ref);
+			void Remove(FormID formID);
+			void RemoveEntry(std::uint32_t index);
+			// Reads the position again, false if the entry was removed
+			bool Refresh(std::uint32_t index, TESObjectREFR* ref);
+
+			std::vector<Entry> entries;
+			std::vector<std::uint32_t> freeEntries;
+			std::unordered_map<FormID, std::uint32_t> byForm;
+			std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> buckets;
+			// Cells scanned once because a query needed them before any attach event
+			std::unordered_set<TESObjectCELL*> scannedCells;
+			std::vector<std::uint32_t> awake;
+			std::size_t refreshCursor = 0;
+
+			// Game events can come from other threads, they are applied in Update
+			std::mutex pendingLock;
+			std::vector<std::pair<FormID, bool>> pending;
+	};
+}
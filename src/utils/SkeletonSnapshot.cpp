@@ -0,0 +1,164 @@
+#include "utils/SkeletonSnapshot.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+#include "node.hpp"
+#include <xmmintrin.h>
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	// Squares to inf, so padding lanes never pass the radius test
+	const float PADDING = std::numeric_limits<float>::max();
+	// Snapshots that were not used for this many frames are dropped (actor unloaded or out of range)
+	const std::uint64_t FORGET_FRAMES = 600;
+}
+
+namespace Gts {
+	void SkeletonSnapshot::Capture(NiAVObject* root) {
+		this->x.clear();
+		this->y.clear();
+		this->z.clear();
+		this->count = 0;
+		this->boundCenter = NiPoint3();
+		this->boundRadius = 0.0f;
+		if (!root) {
+			return;
+		}
+
+		VisitNodes(root, [this](NiAVObject& a_obj) {
+			auto& pos = a_obj.world.translate;
+			this->x.push_back(pos.x);
+			this->y.push_back(pos.y);
+			this->z.push_back(pos.z);
+			return true;
+		});
+		this->count = this->x.size();
+		if (this->count == 0) {
+			return;
+		}
+
+		NiPoint3 min = NiPoint3(this->x[0], this->y[0], this->z[0]);
+		NiPoint3 max = min;
+		for (std::size_t i = 1; i < this->count; i++) {
+			min = NiPoint3(std::min(min.x, this->x[i]), std::min(min.y, this->y[i]), std::min(min.z, this->z[i]));
+			max = NiPoint3(std::max(max.x, this->x[i]), std::max(max.y, this->y[i]), std::max(max.z, this->z[i]));
+		}
+		this->boundCenter = (min + max) * 0.5f;
+		for (std::size_t i = 0; i < this->count; i++) {
+			float dx = this->x[i] - this->boundCenter.x;
+			float dy = this->y[i] - this->boundCenter.y;
+			float dz = this->z[i] - this->boundCenter.z;
+			this->boundRadius = std::max(this->boundRadius, dx * dx + dy * dy + dz * dz);
+		}
+		this->boundRadius = std::sqrt(this->boundRadius);
+
+		std::size_t padded = (this->count + 3) & ~std::size_t(3);
+		this->x.resize(padded, PADDING);
+		this->y.resize(padded, PADDING);
+		this->z.resize(padded, PADDING);
+	}
+
+	bool SkeletonSnapshot::AnyWithinRadius(const NiPoint3& point, float radius, float* hitDistance) const {
+		if (this->count == 0) {
+			return false;
+		}
+		// Whole skeleton is out of reach
+		NiPoint3 toCenter = point - this->boundCenter;
+		float reach = radius + this->boundRadius;
+		if (toCenter.x * toCenter.x + toCenter.y * toCenter.y + toCenter.z * toCenter.z > reach * reach) {
+			return false;
+		}
+
+		const __m128 px = _mm_set1_ps(point.x);
+		const __m128 py = _mm_set1_ps(point.y);
+		const __m128 pz = _mm_set1_ps(point.z);
+		const __m128 r2 = _mm_set1_ps(radius * radius);
+		for (std::size_t i = 0; i < this->x.size(); i += 4) {
+			__m128 dx = _mm_sub_ps(_mm_loadu_ps(&this->x[i]), px);
+			__m128 dy = _mm_sub_ps(_mm_loadu_ps(&this->y[i]), py);
+			__m128 dz = _mm_sub_ps(_mm_loadu_ps(&this->z[i]), pz);
+			__m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			int mask = _mm_movemask_ps(_mm_cmple_ps(d2, r2));
+			if (mask != 0) {
+				if (hitDistance) {
+					float lanes[4];
+					_mm_storeu_ps(lanes, d2);
+					*hitDistance = std::sqrt(lanes[std::countr_zero(static_cast<unsigned int>(mask))]);
+				}
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool SkeletonSnapshot::IsEmpty() const {
+		return this->count == 0;
+	}
+
+	SkeletonSnapshots& SkeletonSnapshots::GetSingleton() noexcept {
+		static SkeletonSnapshots instance;
+		return instance;
+	}
+
+	std::string SkeletonSnapshots::DebugName() {
+		return "SkeletonSnapshots";
+	}
+
+	void SkeletonSnapshots::Update() {
+		std::uint64_t frame = Time::FramesElapsed();
+		if (frame % 60 != 0) {
+			return;
+		}
+		std::erase_if(this->snapshots, [frame](const auto& item) {
+			return item.second.frame == std::numeric_limits<std::uint64_t>::max() || frame > item.second.frame + FORGET_FRAMES;
+		});
+	}
+
+	void SkeletonSnapshots::Reset() {
+		this->snapshots.clear();
+	}
+
+	void SkeletonSnapshots::ResetActor(Actor* actor) {
+		if (actor) {
+			this->snapshots.erase(actor->formID);
+		}
+	}
+
+	const SkeletonSnapshot* SkeletonSnapshots::Get(Actor* actor) {
+		if (!actor) {
+			return nullptr;
+		}
+		auto model = actor->GetCurrent3D();
+		if (!model) {
+			return nullptr;
+		}
+		std::uint64_t frame = Time::FramesElapsed();
+		if (!ActorRegistry::OnRegistryThread()) {
+			// Anim event damage can run on other threads, they get their own copies and never touch the shared map
+			thread_local std::unordered_map<FormID, SkeletonSnapshot> scratch;
+			thread_local std::uint64_t scratchFrame = std::numeric_limits<std::uint64_t>::max();
+			if (scratchFrame != frame) {
+				scratch.clear();
+				scratchFrame = frame;
+			}
+			auto& snapshot = scratch[actor->formID];
+			if (snapshot.frame != frame) {
+				snapshot.Capture(model);
+				snapshot.frame = frame;
+			}
+			return &snapshot;
+		}
+		auto& me = SkeletonSnapshots::GetSingleton();
+		auto& snapshot = me.snapshots[actor->formID];
+		if (snapshot.frame != frame) {
+			auto profiler = Profilers::Profile("SkeletonSnapshot: Capture");
+			snapshot.Capture(model);
+			snapshot.frame = frame;
+		}
+		return &snapshot;
+	}
+}
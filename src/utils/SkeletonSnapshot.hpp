@@ -0,0 +1,53 @@
+#pragma once
+// Module that caches the world positions of an actor's nodes once per frame
+//  Contact checks (feet, hands, knees, breasts, butt) test against this flat copy
+//  instead of walking the scene graph for every point they check
+#include "events.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+
+	class SkeletonSnapshot {
+		public:
+			// Copies the world translation of up to the same nodes VisitNodes would see
+			void Capture(NiAVObject* root);
+
+			// True if any node is within radius of the point
+			// hitDistance (if given) receives the distance of the node that matched
+			bool AnyWithinRadius(const NiPoint3& point, float radius, float* hitDistance = nullptr) const;
+
+			bool IsEmpty() const;
+
+			std::uint64_t frame = std::numeric_limits<std::uint64_t>::max();
+		private:
+			// Padded to a multiple of 4 so the SIMD loop never needs a tail
+			std::vector<float> x;
+			std::vector<float> y;
+			std::vector<float> z;
+			std::size_t count = 0;
+
+			NiPoint3 boundCenter;
+			float boundRadius = 0.0f;
+	};
+
+	class SkeletonSnapshots : public EventListener {
+		public:
+			[[nodiscard]] static SkeletonSnapshots& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+
+			// Snapshot of the actor's current 3D, captured on first use each frame
+			// Returns nullptr if the actor has no 3D, the pointer is only valid for the current frame
+			// Off the main thread the snapshot is a copy owned by the calling thread
+			static const SkeletonSnapshot* Get(Actor* actor);
+
+		private:
+			std::unordered_map<FormID, SkeletonSnapshot> snapshots;
+	};
+}
@@ -0,0 +1,108 @@
+#include "utils/TargetQuery.hpp"
+#include "utils/ActorGrid.hpp"
+#include "utils/actorUtils.hpp"
+#include "utils/findActor.hpp"
+#include "profiler.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	const float PI = 3.14159f;
+
+	// dot / length > cosAngle without the sqrt
+	bool InsideCone(float dot, float lengthSq, float cosAngle) {
+		if (cosAngle >= 0.0f) {
+			return dot > 0.0f && dot * dot > cosAngle * cosAngle * lengthSq;
+		}
+		return dot >= 0.0f || dot * dot < cosAngle * cosAngle * lengthSq;
+	}
+}
+
+namespace Gts {
+	std::vector<Actor*> QueryTargets(Actor* origin, const TargetQuery& query, const std::function<bool(Actor*)>& predicate) {
+		auto profiler = Profilers::Profile("TargetQuery: QueryTargets");
+		if (!origin) {
+			return {};
+		}
+		NiPoint3 originPos = origin->GetPosition();
+		NiPoint3 forward = RotateAngleAxis(NiPoint3(0.0f, 1.0f, 0.0f), -origin->data.angle.z, NiPoint3(0.0f, 0.0f, 1.0f));
+		forward = forward / forward.Length();
+
+		// Same shape the controllers used to build by hand
+		// \      x   /
+		//  \  x     /
+		//   \______/  <- Truncated cone
+		//   | pred |  <- Based on width of pred
+		//   |______|
+		bool useCone = query.coneAngle > 0.0f;
+		NiPoint3 coneStart = originPos;
+		float coneCos = 0.0f;
+		float innerSq = 0.0f;
+		if (useCone) {
+			float shiftAmount = fabs((query.coneWidth / 2.0f) / tan(query.coneAngle / 2.0f));
+			coneStart = originPos - forward * shiftAmount;
+			coneCos = cos(query.coneAngle * PI / 180.0f);
+			innerSq = (query.coneWidth * 0.4f) * (query.coneWidth * 0.4f);
+		}
+		float radiusSq = query.radius * query.radius;
+
+		std::vector<std::pair<float, Actor*>> candidates;
+		auto consider = [&](Actor* actor) {
+			if (!actor) {
+				return;
+			}
+			NiPoint3 position = actor->GetPosition();
+			NiPoint3 delta = position - originPos;
+			float distanceSq = delta.Dot(delta);
+			if (query.radius > 0.0f && distanceSq > radiusSq) {
+				return;
+			}
+			// Not in front (180 degrees)
+			if (distanceSq > 1e-8f && forward.Dot(delta) <= 0.0f) {
+				return;
+			}
+			if (useCone) {
+				NiPoint3 fromStart = position - coneStart;
+				float lengthSq = fromStart.Dot(fromStart);
+				if (lengthSq > innerSq && !InsideCone(forward.Dot(fromStart), lengthSq, coneCos)) {
+					return;
+				}
+			}
+			candidates.emplace_back(distanceSq, actor);
+		};
+
+		if (query.radius > 0.0f) {
+			for (auto entry: ActorGrid::Query(originPos, query.radius)) {
+				consider(entry->actor);
+			}
+		} else {
+			for (auto actor: find_actors()) {
+				consider(actor);
+			}
+		}
+
+		std::erase_if(candidates, [&predicate](const auto& candidate) {
+			return !predicate(candidate.second);
+		});
+
+		auto closer = [](const auto& a, const auto& b) {
+			return a.first < b.first;
+		};
+		if (query.limit < candidates.size()) {
+			std::partial_sort(candidates.begin(), candidates.begin() + query.limit, candidates.end(), closer);
+			candidates.resize(query.limit);
+		} else {
+			std::sort(candidates.begin(), candidates.end(), closer);
+		}
+
+		std::vector<Actor*> result;
+		result.reserve(candidates.size());
+		for (auto& [distanceSq, actor]: candidates) {
+			result.push_back(actor);
+		}
+		return result;
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+// Target selection shared by the action controllers (vore, grab, hug, stomp, ...)
+//  Candidates come from the ActorGrid, are filtered by radius and the forward truncated cone
+//  using squared distances, and only then handed to the (expensive) validity check
+
+using namespace std;
+using namespace RE;
+using namespace SKSE;
+
+namespace Gts {
+	struct TargetQuery {
+		static constexpr std::size_t ALL = std::numeric_limits<std::size_t>::max();
+
+		// Broadphase radius around the origin, <= 0 scans every loaded actor
+		float radius = 0.0f;
+		// Truncated cone in front of the origin, angle in degrees, <= 0 only keeps the front half
+		float coneAngle = 0.0f;
+		// Width of the truncated end of the cone (width of the origin actor)
+		float coneWidth = 0.0f;
+		// Closest N targets that pass
+		std::size_t limit = ALL;
+	};
+
+	// Closest first, the predicate is only called on actors inside the radius and cone
+	std::vector<Actor*> QueryTargets(Actor* origin, const TargetQuery& query, const std::function<bool(Actor*)>& predicate);
+}
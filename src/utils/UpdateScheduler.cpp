@@ -0,0 +1,268 @@
+#include "utils/UpdateScheduler.hpp"
+#include "scale/scale.hpp"
+#include "data/world.hpp"
+#include "data/time.hpp"
+#include "profiler.hpp"
+
+using namespace Gts;
+using namespace RE;
+using namespace SKSE;
+using namespace std;
+
+namespace {
+	// Inside this range actors are updated every frame even when off screen
+	const float NEAR_DISTANCE = 1024.0f;
+	// On screen actors past this and everyone off screen inside it get every second/fourth frame
+	const float FAR_DISTANCE = 4096.0f;
+	// Actors at least this big drive the visible effects and are always updated
+	const float LARGE_SCALE = 1.5f;
+	// Roughly the chest of a normal sized actor, the feet are often below the screen
+	const float SCREEN_POINT_HEIGHT = 96.0f;
+	// Actors that were not loaded for this many frames are forgotten
+	const std::uint64_t FORGET_FRAMES = 600;
+
+	bool IsOnScreen(Actor* actor) {
+		NiPoint3 point = actor->GetPosition();
+		point.z += SCREEN_POINT_HEIGHT * get_visual_scale(actor);
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+		if (!NiCamera::WorldPtToScreenPt3(World::WorldToCamera().data, World::ViewPort(), point, x, y, z, 1e-5f)) {
+			return false;
+		}
+		return x >= 0.0f && x <= 1.0f && y >= 0.0f && y <= 1.0f;
+	}
+}
+
+namespace Gts {
+	UpdateScheduler& UpdateScheduler::GetSingleton() noexcept {
+		static UpdateScheduler instance;
+		return instance;
+	}
+
+	std::string UpdateScheduler::DebugName() {
+		return "UpdateScheduler";
+	}
+
+	void UpdateScheduler::Update() {
+		std::uint64_t frame = Time::FramesElapsed();
+		if (frame % 60 != 0) {
+			return;
+		}
+		auto profiler = Profilers::Profile("UpdateScheduler: Update");
+		std::unique_lock guard(this->lock);
+		for (auto& task: this->tasks) {
+			std::uint64_t now = task.config.perCall ? task.calls : frame;
+			std::erase_if(task.lastRun, [now](const auto& item) {
+				return now > item.second.ran + FORGET_FRAMES;
+			});
+		}
+	}
+
+	void UpdateScheduler::Reset() {
+		std::unique_lock guard(this->lock);
+		for (auto& task: this->tasks) {
+			task.lastRun.clear();
+		}
+		this->importance.clear();
+		this->importanceFrame = std::numeric_limits<std::uint64_t>::max();
+	}
+
+	void UpdateScheduler::ResetActor(Actor* actor) {
+		if (!actor) {
+			return;
+		}
+		std::unique_lock guard(this->lock);
+		for (auto& task: this->tasks) {
+			task.lastRun.erase(actor->formID);
+		}
+		this->importance.erase(actor->formID);
+	}
+
+	UpdateTaskId UpdateScheduler::Register(UpdateTask task) {
+		auto& me = UpdateScheduler::GetSingleton();
+		std::unique_lock guard(me.lock);
+		me.tasks.push_back(TaskState { .config = std::move(task) });
+		return static_cast<UpdateTaskId>(me.tasks.size() - 1);
+	}
+
+	void UpdateScheduler::Run(UpdateTaskId task, const std::function<void(Actor* actor, std::uint64_t frames)>& func) {
+		auto& me = UpdateScheduler::GetSingleton();
+		std::uint64_t frame = 0;
+		std::vector<Pending> pending;
+		double budgetMs = 0.0;
+		{
+			std::unique_lock guard(me.lock);
+			if (task >= me.tasks.size()) {
+				return;
+			}
+			auto& state = me.tasks[task];
+			frame = UpdateScheduler::Tick(state);
+			pending = me.Schedule(state, ActorRegistry::Records(), frame);
+			budgetMs = state.config.budgetMs;
+		}
+
+		// Called without the lock, func may use the scheduler itself
+		auto start = std::chrono::steady_clock::now();
+		std::size_t ran = 0;
+		for (; ran < pending.size(); ran++) {
+			auto& entry = pending[ran];
+			if (entry.rate != UpdateRate::Always && budgetMs > 0.0) {
+				std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+				if (elapsed.count() >= budgetMs) {
+					// Everything left is less overdue than what ran, Always actors are sorted first
+					break;
+				}
+			}
+			func(entry.actor, entry.frames);
+		}
+		me.MarkRun(task, std::span(pending.data(), ran), frame);
+	}
+
+	std::vector<Actor*> UpdateScheduler::Due(UpdateTaskId task) {
+		return UpdateScheduler::Due(task, ActorRegistry::Records());
+	}
+
+	std::vector<Actor*> UpdateScheduler::Due(UpdateTaskId task, std::span<const ActorRecord> records) {
+		auto& me = UpdateScheduler::GetSingleton();
+		std::uint64_t frame = 0;
+		std::vector<Pending> pending;
+		{
+			std::unique_lock guard(me.lock);
+			if (task >= me.tasks.size()) {
+				return {};
+			}
+			auto& state = me.tasks[task];
+			frame = UpdateScheduler::Tick(state);
+			pending = me.Schedule(state, records, frame);
+		}
+		me.MarkRun(task, pending, frame);
+
+		std::vector<Actor*> result;
+		result.reserve(pending.size());
+		for (auto& entry: pending) {
+			result.push_back(entry.actor);
+		}
+		return result;
+	}
+
+	UpdateRate UpdateScheduler::Importance(const ActorRecord& record) {
+		auto& me = UpdateScheduler::GetSingleton();
+		std::unique_lock guard(me.lock);
+		return me.ComputeImportance(record);
+	}
+
+	std::vector<UpdateScheduler::Pending> UpdateScheduler::Schedule(TaskState& task, std::span<const ActorRecord> records, std::uint64_t frame) {
+		std::vector<Pending> pending;
+		pending.reserve(records.size());
+		for (auto& record: records) {
+			if (!record.actor) {
+				continue;
+			}
+			UpdateRate rate = task.config.priority ? task.config.priority(record) : this->ComputeImportance(record);
+			std::uint64_t interval = std::max<std::uint64_t>(static_cast<std::uint64_t>(rate), 1);
+
+			float overdue = std::numeric_limits<float>::max();
+			std::uint64_t frames = 1;
+			auto found = task.lastRun.find(record.formID);
+			if (found != task.lastRun.end()) {
+				std::uint64_t since = frame - std::min(found->second.scheduled, frame);
+				// Always is due again even if the task runs twice in a frame
+				if (since < interval && rate != UpdateRate::Always) {
+					continue;
+				}
+				overdue = static_cast<float>(since) / static_cast<float>(interval);
+				frames = std::max<std::uint64_t>(frame - std::min(found->second.ran, frame), 1);
+			}
+			pending.push_back(Pending {
+				.actor = record.actor,
+				.formID = record.formID,
+				.rate = rate,
+				.overdue = overdue,
+				.frames = frames,
+			});
+		}
+
+		std::sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+			bool alwaysA = a.rate == UpdateRate::Always;
+			bool alwaysB = b.rate == UpdateRate::Always;
+			if (alwaysA != alwaysB) {
+				return alwaysA;
+			}
+			if (a.overdue != b.overdue) {
+				return a.overdue > b.overdue;
+			}
+			return a.formID < b.formID;
+		});
+
+		if (task.config.maxActors > 0) {
+			std::uint32_t count = 0;
+			std::erase_if(pending, [&count, max = task.config.maxActors](const Pending& entry) {
+				if (entry.rate == UpdateRate::Always) {
+					return false;
+				}
+				count += 1;
+				return count > max;
+			});
+		}
+		return pending;
+	}
+
+	std::uint64_t UpdateScheduler::Tick(TaskState& task) {
+		if (task.config.perCall) {
+			task.calls += 1;
+			return task.calls;
+		}
+		return Time::FramesElapsed();
+	}
+
+	void UpdateScheduler::MarkRun(UpdateTaskId task, std::span<const Pending> ran, std::uint64_t frame) {
+		std::unique_lock guard(this->lock);
+		auto& lastRun = this->tasks[task].lastRun;
+		for (auto& entry: ran) {
+			auto [found, inserted] = lastRun.try_emplace(entry.formID, LastRun { .scheduled = frame, .ran = frame });
+			if (inserted) {
+				// Actors loaded together would otherwise stay in step and all come due on the same frame
+				std::uint64_t interval = std::max<std::uint64_t>(static_cast<std::uint64_t>(entry.rate), 1);
+				found->second.scheduled = frame - std::min<std::uint64_t>(entry.formID % interval, frame);
+			} else {
+				found->second = LastRun { .scheduled = frame, .ran = frame };
+			}
+		}
+	}
+
+	UpdateRate UpdateScheduler::ComputeImportance(const ActorRecord& record) {
+		std::uint64_t frame = Time::FramesElapsed();
+		if (this->importanceFrame != frame) {
+			this->importance.clear();
+			this->importanceFrame = frame;
+		}
+		auto found = this->importance.find(record.formID);
+		if (found != this->importance.end()) {
+			return found->second;
+		}
+
+		UpdateRate rate = UpdateRate::EveryEighthFrame;
+		Actor* actor = record.actor;
+		auto player = PlayerCharacter::GetSingleton();
+		if (record.isPlayer || record.isTeammate || !player) {
+			rate = UpdateRate::Always;
+		} else if (record.isDead) {
+			rate = UpdateRate::EveryEighthFrame;
+		} else if (get_visual_scale(actor) >= LARGE_SCALE) {
+			rate = UpdateRate::Always;
+		} else {
+			float distance = (actor->GetPosition() - player->GetPosition()).Length();
+			bool onScreen = distance < FAR_DISTANCE * 2.0f && IsOnScreen(actor);
+			if (distance < NEAR_DISTANCE || (onScreen && distance < FAR_DISTANCE)) {
+				rate = UpdateRate::EveryFrame;
+			} else if (onScreen) {
+				rate = UpdateRate::EverySecondFrame;
+			} else if (distance < FAR_DISTANCE) {
+				rate = UpdateRate::EveryFourthFrame;
+			}
+		}
+		this->importance.insert_or_assign(record.formID, rate);
+		return rate;
+	}
+}
@@ -0,0 +1,104 @@
+#pragma once
+// Importance based update rate for per actor work
+//  Each task rates every loaded actor, by default the player, teammates and large actors are always
+//  updated, nearby/on screen actors every frame and distant small NPCs only every few frames
+//  Actors that are due are handled most overdue first and a task can have a time budget, actors
+//  cut off by it are first in line on the next frame so everyone keeps getting updated
+#include "events.hpp"
+#include "utils/ActorRegistry.hpp"
+
+using namespace std;
+using namespace SKSE;
+using namespace RE;
+
+namespace Gts {
+	// Frames between two updates of an actor
+	enum class UpdateRate : std::uint8_t {
+		// Due on every call (even several in one frame) and never held back by the budget or maxActors
+		Always = 0,
+		EveryFrame = 1,
+		EverySecondFrame = 2,
+		EveryFourthFrame = 4,
+		EveryEighthFrame = 8,
+	};
+
+	using UpdateTaskId = std::uint32_t;
+
+	struct UpdateTask {
+		std::string name;
+		// UpdateScheduler::Importance if empty
+		std::function<UpdateRate(const ActorRecord&)> priority;
+		// Time for the actors that are not Always in Run(), <= 0 is unlimited
+		double budgetMs = 0.25;
+		// Actors that are not Always per frame, 0 is unlimited
+		std::uint32_t maxActors = 0;
+		// Rates count calls to Run/Due instead of frames, for tasks called several times per frame
+		bool perCall = false;
+	};
+
+	class UpdateScheduler : public EventListener {
+		public:
+			[[nodiscard]] static UpdateScheduler& GetSingleton() noexcept;
+
+			virtual std::string DebugName() override;
+			virtual void Update() override;
+			virtual void Reset() override;
+			virtual void ResetActor(Actor* actor) override;
+
+			// Keep the id in a static at the call site, tasks are never removed
+			static UpdateTaskId Register(UpdateTask task);
+
+			// Calls func for the actors of the task that are due this frame, until the budget is used up
+			// frames is how many frames (calls if perCall) passed since the actor was last handled by this task (1 the first time),
+			// per frame amounts (e.g. damage over time) should be scaled by it
+			// Main thread only, the actors come from ActorRegistry
+			static void Run(UpdateTaskId task, const std::function<void(Actor* actor, std::uint64_t frames)>& func);
+			// Actors due this frame (maxActors applies, the budget does not), they count as updated
+			// records defaults to ActorRegistry::Records()
+			static std::vector<Actor*> Due(UpdateTaskId task);
+			static std::vector<Actor*> Due(UpdateTaskId task, std::span<const ActorRecord> records);
+
+			// Default priority, cached for the current frame
+			static UpdateRate Importance(const ActorRecord& record);
+
+		private:
+			struct Pending {
+				Actor* actor;
+				FormID formID;
+				UpdateRate rate;
+				// Frames since the last update divided by the rate, >= 1 when due
+				float overdue;
+				// Frames since the last update, 1 if the actor is new
+				std::uint64_t frames;
+			};
+
+			struct LastRun {
+				// Phase shifted on the first run, only used to decide when the actor is due
+				std::uint64_t scheduled;
+				// Frame the actor was really updated
+				std::uint64_t ran;
+			};
+
+			struct TaskState {
+				UpdateTask config;
+				std::unordered_map<FormID, LastRun> lastRun;
+				// Calls to Run/Due, the clock of perCall tasks
+				std::uint64_t calls = 0;
+			};
+
+			// Must hold lock, the frame (or call for perCall tasks) being scheduled
+			static std::uint64_t Tick(TaskState& task);
+			void MarkRun(UpdateTaskId task, std::span<const Pending> ran, std::uint64_t frame);
+			// Must hold lock
+			std::vector<Pending> Schedule(TaskState& task, std::span<const ActorRecord> records, std::uint64_t frame);
+			UpdateRate ComputeImportance(const ActorRecord& record);
+
+			// Recursive so priority functions can fall back to Importance()
+			std::recursive_mutex lock;
+			// Indexed by UpdateTaskId
+			std::vector<TaskState> tasks;
+
+			std::unordered_map<FormID, UpdateRate> importance;
+			std::uint64_t importanceFrame = std::numeric_limits<std::uint64_t>::max();
+	};
+}
@@ -201,9 +201,9 @@ namespace {
 		ActorHandle actor;
 
 		SpringGrowData(Actor* actor, float amountToAdd, float halfLife) : actor(actor->CreateRefHandle()) {
-			amount.value = 0.0f;
-			amount.target = amountToAdd;
-			amount.halflife = halfLife;
+			amount.SetValue(0.0f);
+			amount.SetTarget(amountToAdd);
+			amount.SetHalfLife(halfLife);
 		}
 	};
 
@@ -213,9 +213,9 @@ namespace {
 		ActorHandle actor;
 
 		SpringShrinkData(Actor* actor, float amountToAdd, float halfLife) : actor(actor->CreateRefHandle()) {
-			amount.value = 0.0f;
-			amount.target = amountToAdd;
-			amount.halflife = halfLife;
+			amount.SetValue(0.0f);
+			amount.SetTarget(amountToAdd);
+			amount.SetHalfLife(halfLife);
 		}
 	};
 }
@@ -828,11 +828,11 @@ namespace Gts {
 	}
 
 	float GetDamageResistance(Actor* actor) {
-		return AttributeManager::GetSingleton().GetAttributeBonus(actor, ActorValue::kHealth);
+		return AttributeManager::GetSingleton().GetFrameAttributeBonus(actor, ActorValue::kHealth);
 	}
 
 	float GetDamageMultiplier(Actor* actor) {
-		return AttributeManager::GetSingleton().GetAttributeBonus(actor, ActorValue::kAttackDamageMult);
+		return AttributeManager::GetSingleton().GetFrameAttributeBonus(actor, ActorValue::kAttackDamageMult);
 	}
 
 	float Damage_CalculateSizeDamage(Actor* giant, Actor* tiny) {
@@ -2474,21 +2474,8 @@ namespace Gts {
 			if (otherActor != giant) {
 				NiPoint3 actorLocation = otherActor->GetPosition();
 				if ((actorLocation-giantLocation).Length() < (maxDistance*giantScale * 3.0f)) {
-					int nodeCollisions = 0;
-					float force = 0.0f;
-					auto model = otherActor->GetCurrent3D();
-					if (model) {
-						VisitNodes(model, [&nodeCollisions, &force, NodePosition, totaldistance](NiAVObject& a_obj) {
-							float distance = (NodePosition - a_obj.world.translate).Length();
-							if (distance < totaldistance) {
-								nodeCollisions += 1;
-								force = 1.0f - distance / totaldistance;
-								return false;
-							}
-							return true;
-						});
-					}
-					if (nodeCollisions > 0) {
+					auto skeleton = SkeletonSnapshots::Get(otherActor);
+					if (skeleton && skeleton->AnyWithinRadius(NodePosition, totaldistance)) {
 						float sizedifference = giantScale/get_visual_scale(otherActor);
 						if (sizedifference <= 1.6f) {
 							StaggerActor(giant, otherActor, 0.75f);
@@ -2583,23 +2570,8 @@ namespace Gts {
 			if (otherActor != giant) {
 				NiPoint3 actorLocation = otherActor->GetPosition();
 				if ((actorLocation - giantLocation).Length() < BASE_DISTANCE*giantScale*radius*3) {
-					int nodeCollisions = 0;
-					float force = 0.0f;
-
-					auto model = otherActor->GetCurrent3D();
-
-					if (model) {
-						VisitNodes(model, [&nodeCollisions, &force, NodePosition, CheckDistance](NiAVObject& a_obj) {
-							float distance = (NodePosition - a_obj.world.translate).Length();
-							if (distance < CheckDistance) {
-								nodeCollisions += 1;
-								force = 1.0f - distance / CheckDistance;
-								return false;
-							}
-							return true;
-						});
-					}
-					if (nodeCollisions > 0) {
+					auto skeleton = SkeletonSnapshots::Get(otherActor);
+					if (skeleton && skeleton->AnyWithinRadius(NodePosition, CheckDistance)) {
 						ShrinkOutburst_Shrink(giant, otherActor, shrink, gigantism);
 					}
 				}
@@ -2857,23 +2829,8 @@ namespace Gts {
 			if (otherActor != giant) {
 				NiPoint3 actorLocation = otherActor->GetPosition();
 				if ((actorLocation - giantLocation).Length() < CheckDistance*3) {
-					int nodeCollisions = 0;
-					float force = 0.0f;
-
-					auto model = otherActor->GetCurrent3D();
-
-					if (model) {
-						VisitNodes(model, [&nodeCollisions, &force, NodePosition, CheckDistance](NiAVObject& a_obj) {
-							float distance = (NodePosition - a_obj.world.translate).Length();
-							if (distance < CheckDistance) {
-								nodeCollisions += 1;
-								force = 1.0f - distance / CheckDistance;
-								return false;
-							}
-							return true;
-						});
-					}
-					if (nodeCollisions > 0) {
+					auto skeleton = SkeletonSnapshots::Get(otherActor);
+					if (skeleton && skeleton->AnyWithinRadius(NodePosition, CheckDistance)) {
 						if (!launch) {
 							StaggerActor(giant, otherActor, 0.50f);
 						} else {
@@ -3087,7 +3044,7 @@ namespace Gts {
 
 		TaskManager::RunFor(DURATION,
 		                    [ growData ](const auto& progressData) {
-			float totalScaleToAdd = growData->amount.value;
+			float totalScaleToAdd = growData->amount.GetValue();
 			float prevScaleAdded = growData->addedSoFar;
 			float deltaScale = totalScaleToAdd - prevScaleAdded;
 			bool drain_stamina = growData->drain;
@@ -3111,7 +3068,7 @@ namespace Gts {
 					}
 				}
 			}
-			return fabs(growData->amount.value - growData->amount.target) > 1e-4;
+			return fabs(growData->amount.GetValue() - growData->amount.GetTarget()) > 1e-4;
 		});
 	}
 
@@ -3125,7 +3082,7 @@ namespace Gts {
 		const float DURATION = halfLife * 3.2f;
 		TaskManager::RunFor(DURATION,
 		                    [ growData ](const auto& progressData) {
-			float totalScaleToAdd = growData->amount.value;
+			float totalScaleToAdd = growData->amount.GetValue();
 			float prevScaleAdded = growData->addedSoFar;
 			float deltaScale = totalScaleToAdd - prevScaleAdded;
 			Actor* actor = growData->actor.get().get();
@@ -3141,7 +3098,7 @@ namespace Gts {
 				}
 			}
 
-			return fabs(growData->amount.value - growData->amount.target) > 1e-4;
+			return fabs(growData->amount.GetValue() - growData->amount.GetTarget()) > 1e-4;
 		});
 	}
 
@@ -3192,7 +3149,7 @@ namespace Gts {
 			if (progressionQuest) {
 				auto queststage = progressionQuest->GetCurrentStageID();
 
-				logger::debug("CanPerformAnimation (Stage: {} / Type: {})", queststage, static_cast<int>(type));
+				GTS_LOG_DEBUG("CanPerformAnimation (Stage: {} / Type: {})", queststage, static_cast<int>(type));
 
 				if (queststage >= 10 && type == AnimationCondition::kHugs) {
 					return true; // allow hugs
@@ -3407,12 +3364,16 @@ namespace Gts {
 	float Sound_GetFallOff(NiAVObject* source, float mult) {
 		if (source) {
 			float distance_to_camera = unit_to_meter(get_distance_to_camera(source));
-			// Camera distance based volume falloff
-			return soft_core(distance_to_camera, 0.024f / mult, 2.0f, 0.8f, 0.0f, 0.0f);
+			return Sound_GetFallOff(distance_to_camera, mult);
 		}
 		return 1.0f;
 	} 
 
+	float Sound_GetFallOff(float distance_to_camera, float mult) {
+		// Camera distance based volume falloff
+		return soft_core(distance_to_camera, 0.024f / mult, 2.0f, 0.8f, 0.0f, 0.0f);
+	}
+
 	// RE Fun
 	void SetCriticalStage(Actor* actor, int stage) {
 		if (stage < 5 && stage >= 0) {
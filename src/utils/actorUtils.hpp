@@ -315,6 +315,8 @@ namespace Gts {
 	void InflictSizeDamage(Actor* attacker, Actor* receiver, float value);
 
 	float Sound_GetFallOff(NiAVObject* source, float mult);
+	// Same falloff for a camera distance (in meters) that was already computed
+	float Sound_GetFallOff(float distance_to_camera, float mult);
 
 	// RE Fun:
 	void SetCriticalStage(Actor* actor, int stage);
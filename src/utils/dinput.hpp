@@ -191,6 +191,10 @@
  */
 
 #define MOUSE_OFFSET        0x100
+// Gamepad buttons are bit flags (triggers are 0x9/0xA), they are stored by bit index after this
+#define GAMEPAD_OFFSET      0x200
+// Size of the key state, keyboard + mouse + gamepad
+#define INPUT_KEY_COUNT     0x300
 
 const std::unordered_map<std::string, std::uint32_t> NAMED_KEYS = {
 	{ "DIK_ESCAPE", DIK_ESCAPE },
@@ -527,4 +531,22 @@ const std::unordered_map<std::string, std::uint32_t> NAMED_KEYS = {
 	{ "MOUSE3", 0x02 + MOUSE_OFFSET },
 	{ "MOUSE4", 0x03 + MOUSE_OFFSET },
 	{ "MOUSE5", 0x04 + MOUSE_OFFSET }, 
+
+	// Names as they are after LEFT/RIGHT were shortened to L/R
+	{ "GAMEPAD_DPAD_UP", 0x00 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_DPAD_DOWN", 0x01 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_DPAD_L", 0x02 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_DPAD_R", 0x03 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_START", 0x04 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_BACK", 0x05 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_LTHUMB", 0x06 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_RTHUMB", 0x07 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_LSHOULDER", 0x08 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_RSHOULDER", 0x09 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_A", 0x0C + GAMEPAD_OFFSET },
+	{ "GAMEPAD_B", 0x0D + GAMEPAD_OFFSET },
+	{ "GAMEPAD_X", 0x0E + GAMEPAD_OFFSET },
+	{ "GAMEPAD_Y", 0x0F + GAMEPAD_OFFSET },
+	{ "GAMEPAD_LT", 0x10 + GAMEPAD_OFFSET },
+	{ "GAMEPAD_RT", 0x11 + GAMEPAD_OFFSET },
 };
@@ -1,4 +1,6 @@
 #include "utils/findActor.hpp"
+#include "utils/ActorRegistry.hpp"
+#include "utils/UpdateScheduler.hpp"
 #include "utils/actorUtils.hpp"
 #include "profiler.hpp"
 
@@ -7,11 +9,23 @@ using namespace RE;
 using namespace SKSE;
 
 namespace {
-	class FindActorData {
-		public:
-			/// Actors that have been done recently;
-			unordered_set<FormID> previousActors;
-	};
+	/// Registry records on the main thread, otherwise built into scratch from a fresh scan
+	std::span<const ActorRecord> GetActorRecords(std::vector<ActorRecord>& scratch) {
+		if (ActorRegistry::OnRegistryThread()) {
+			return ActorRegistry::Records();
+		}
+		for (auto actor: find_actors()) {
+			scratch.push_back(ActorRecord {
+				.actor = actor,
+				.formID = actor->formID,
+				.isPlayer = actor->formID == 0x14,
+				.isTeammate = IsTeammate(actor),
+				.is3DLoaded = true,
+				.isDead = actor->IsDead(),
+			});
+		}
+		return scratch;
+	}
 }
 
 namespace Gts {
@@ -44,6 +58,17 @@ namespace Gts {
 
 	vector<Actor*> find_actors() { // Backup above ^
 		auto profiler = Profilers::Profile("Other: Find Actors");
+		if (ActorRegistry::OnRegistryThread()) {
+			// Already resolved this frame
+			vector<Actor*> result;
+			for (auto actor: ActorRegistry::Actors()) {
+				// Actors reset during this frame are null
+				if (actor) {
+					result.push_back(actor);
+				}
+			}
+			return result;
+		}
 		vector<Actor*> result;
 		auto high_actors = find_actors_high();
 
@@ -150,54 +175,32 @@ namespace Gts {
 	}
 
 	vector<Actor*> FindSomeActors(std::string_view tag, uint32_t howMany) {
-		static unordered_map<string, FindActorData> allData;
-		allData.try_emplace(string(tag));
-		auto& data = allData.at(string(tag));
-
-		//log::info("Looking for actor for {} up to a count of {}", tag, howMany);
-		vector<Actor*> finalActors;
-		vector<Actor*> notAddedAcrors;
-		uint32_t addedCount = 0;
-		for (auto actor: find_actors()) {
-			// Player or teammate are always updated
-			if (actor->formID == 0x14 || IsTeammate(actor)) {
-				finalActors.push_back(actor);
-				//log::info(" - Adding: {}", actor->GetDisplayFullName());
-			} else if ((data.previousActors.count(actor->formID) == 0) && (addedCount < howMany)) {
-				// Other actors are only added if they are not in the previous actor list
-
-				//log::info(" - Adding: {}", actor->GetDisplayFullName());
-				finalActors.push_back(actor);
-				data.previousActors.insert(actor->formID);
-				addedCount += 1;
-
-			} else {
-				notAddedAcrors.push_back(actor);
-			}
-		}
-		// Reached the end of all actor
-		if (addedCount < howMany) {
-			// We need more. Reset the used list and add from
-			// those not added set
-			data.previousActors.clear();
-			for (auto actor: notAddedAcrors) {
-				if (addedCount < howMany) {
-					finalActors.push_back(actor);
-					data.previousActors.insert(actor->formID);
-					addedCount += 1;
-				} else {
-					break;
-				}
-			}
+		// One round robin task per tag, the actors that waited longest come first
+		static unordered_map<string, UpdateTaskId> tasks;
+		auto [task, inserted] = tasks.try_emplace(string(tag), 0);
+		if (inserted) {
+			task->second = UpdateScheduler::Register(UpdateTask {
+				.name = string(tag),
+				.priority = [](const ActorRecord& record) {
+					// Player or teammate are always updated
+					return (record.isPlayer || record.isTeammate) ? UpdateRate::Always : UpdateRate::EveryFrame;
+				},
+				.budgetMs = 0.0,
+				.maxActors = howMany,
+				// Rotates on every call, callers may ask several times per frame
+				.perCall = true,
+			});
 		}
-		return finalActors;
+		std::vector<ActorRecord> scratch;
+		return UpdateScheduler::Due(task->second, GetActorRecords(scratch));
 	}
 
 	vector<Actor*> FindTeammates() {
 		vector<Actor*> finalActors;
-		for (auto actor: find_actors()) {
-			if (IsTeammate(actor)) {
-				finalActors.push_back(actor);
+		std::vector<ActorRecord> scratch;
+		for (auto& record: GetActorRecords(scratch)) {
+			if (record.actor && record.isTeammate) {
+				finalActors.push_back(record.actor);
 			}
 		}
 		return finalActors;
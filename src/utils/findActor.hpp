@@ -16,9 +16,12 @@ namespace Gts {
 	// regardless of howMany are asked for)
 	//
 	// Any actors not found in this call will instead be returned on next call
-	// This means that in frame 1 you can get 10 actors + player team
-	// In frame 2 you will get 10 DIFFERENT actors + player team
+	// This means that in call 1 you can get 10 actors + player team
+	// In call 2 (even in the same frame) you will get 10 DIFFERENT actors + player team
 	// Until all actors have been returned after which you will get previous actors again
+	//
+	// This is a round robin UpdateScheduler task per tag, register a task yourself to
+	// get an update rate based on distance/scale instead
 	vector<Actor*> FindSomeActors(std::string_view tag, uint32_t howMany);
 
 	// Find player teammates
@@ -1,5 +1,6 @@
 #include "utils/smooth.hpp"
 #include "spring.hpp"
+#include <xmmintrin.h>
 
 using namespace RE;
 using namespace SKSE;
@@ -38,6 +39,44 @@ namespace Gts {
 		v = eydt*(v - j1*y*dt);
 	}
 
+	void critically_damped_batch(
+		float* x,
+		float* v,
+		const float* x_goal,
+		const float* halflife,
+		std::size_t count,
+		float dt)
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 ln2_4 = _mm_set1_ps(4.0f * 0.69314718056f);
+		const __m128 eps = _mm_set1_ps(1e-5f);
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 c2 = _mm_set1_ps(0.48f);
+		const __m128 c3 = _mm_set1_ps(0.235f);
+		const __m128 dt4 = _mm_set1_ps(dt);
+
+		std::size_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m128 goal = _mm_loadu_ps(x_goal + i);
+			__m128 vel = _mm_loadu_ps(v + i);
+			// halflife_to_damping(halflife) / 2.0f
+			__m128 y = _mm_mul_ps(_mm_div_ps(ln2_4, _mm_add_ps(_mm_loadu_ps(halflife + i), eps)), half);
+			__m128 j0 = _mm_sub_ps(_mm_loadu_ps(x + i), goal);
+			__m128 j1 = _mm_add_ps(vel, _mm_mul_ps(j0, y));
+			// fast_negexp(y*dt)
+			__m128 ydt = _mm_mul_ps(y, dt4);
+			__m128 ydt2 = _mm_mul_ps(ydt, ydt);
+			__m128 poly = _mm_add_ps(_mm_add_ps(one, ydt), _mm_add_ps(_mm_mul_ps(c2, ydt2), _mm_mul_ps(c3, _mm_mul_ps(ydt2, ydt))));
+			__m128 eydt = _mm_div_ps(one, poly);
+
+			_mm_storeu_ps(x + i, _mm_add_ps(_mm_mul_ps(eydt, _mm_add_ps(j0, _mm_mul_ps(j1, dt4))), goal));
+			_mm_storeu_ps(v + i, _mm_mul_ps(eydt, _mm_sub_ps(vel, _mm_mul_ps(_mm_mul_ps(j1, y), dt4))));
+		}
+		for (; i < count; i++) {
+			critically_damped(x[i], v[i], x_goal[i], halflife[i], dt);
+		}
+	}
+
 	//https://www.desmos.com/calculator/8lqgse3jkr
 	//https://www.desmos.com/calculator/peog2oomvo
 	float bezier_curve(const float x,const float x1, const float x2, const float x3, const float x4, const float i, const float k) {
@@ -11,6 +11,15 @@ namespace Gts {
 		float halflife,
 		float dt);
 
+	// Same as critically_damped for count springs at once, 4 at a time with SSE
+	void critically_damped_batch(
+		float* x,
+		float* v,
+		const float* x_goal,
+		const float* halflife,
+		std::size_t count,
+		float dt);
+
 
 	struct SoftPotential {
 		float k;